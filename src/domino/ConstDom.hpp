@@ -0,0 +1,465 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: Domino whose DAG is fixed at build time, eg same 200-tile NE bring-up on every node
+// - why:
+//   . dyn Domino pays per node at runtime: setPrev() (loop check + vector links + hash EvName), per wave
+//     stack-deduce via vector<EVs>, all heap
+//   . but a fixed DAG is known by compiler
+//
+// - how:
+//   . DAG = constexpr tables: makeConstDag(EvNames[], ConstLinks[])
+//   . ConstDom<DAG> computes at compile time (ConstGraph):
+//     . EvName -> const Event: DAG.ev("e1") (compile time) or getEventBy() (binary search, no hash)
+//     . CSR adjacency: prev/next in flat std::array
+//     . topological order: 1 forward sweep per wave (dirty bitmap), no stack, each ev deduced at most once
+//     . init states: no setPrev() at startup at all
+//     . static_assert: unknown EvName, dup EvName, loop, T/F conflict -> compile error than runtime ERR
+//   . runtime mem is fixed std::array: no heap on hot path (except MsgCB itself)
+//
+// - how to use:
+//     constexpr const char* BRINGUP_EN[] = {"e0", "e1", "e2"};
+//     constexpr ConstLink   BRINGUP_LINK[] = {{"e1", "e0", true}, {"e2", "e1", true}};  // e1's prev e0 ==T
+//     constexpr auto        BRINGUP = makeConstDag(BRINGUP_EN, BRINGUP_LINK);  // namespace scope (static)
+//     ConstDom<BRINGUP> dom;  // then same API as HdlrDomino: state()/setState()/setHdlr()/rmOneHdlrOK()
+//
+// - core: G_ (compile time) & states_ (runtime)
+// - class safe: yes (same hdlr safety as HdlrDomino: HdlrSlab handle)
+// - MT safe: no
+// ***********************************************************************************************
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Domino.hpp"
+#include "HdlrSlab.hpp"
+#include "MsgSelf.hpp"
+#include "ObjAnywhere.hpp"
+#include "UniLog.hpp"
+#include "UniPtr.hpp"
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct ConstLink
+{
+    const char* en_;         // this ev
+    const char* prevEn_;     // its prev
+    bool        prevState_;  // req state of prev
+};
+
+constexpr int constStrCmp(const char* aL, const char* aR) noexcept
+{
+    for (; *aL != '\0' && *aL == *aR; ++aL, ++aR) {}
+    return static_cast<unsigned char>(*aL) - static_cast<unsigned char>(*aR);
+}
+
+// ***********************************************************************************************
+template<size_t aN_EV, size_t aN_LINK>
+struct ConstDag
+{
+    static constexpr size_t N_EV   = aN_EV;
+    static constexpr size_t N_LINK = aN_LINK;
+
+    std::array<const char*, aN_EV> evNames_{};  // [event]=evName
+    std::array<ConstLink, aN_LINK> links_{};
+
+    // - compile-time EvName -> Event; D_EVENT_FAILED_RET if not found
+    constexpr Domino::Event ev(const char* aEN) const noexcept
+    {
+        for (Domino::Event ev = 0; ev < aN_EV; ++ev)
+            if (constStrCmp(evNames_[ev], aEN) == 0)
+                return ev;
+        return Domino::D_EVENT_FAILED_RET;
+    }
+};
+
+template<size_t aN_EV, size_t aN_LINK>
+constexpr auto makeConstDag(const char* const (&aEvNames)[aN_EV], const ConstLink (&aLinks)[aN_LINK]) noexcept
+{
+    ConstDag<aN_EV, aN_LINK> dag;
+    for (size_t i = 0; i < aN_EV; ++i)
+        dag.evNames_[i] = aEvNames[i];
+    for (size_t i = 0; i < aN_LINK; ++i)
+        dag.links_[i] = aLinks[i];
+    return dag;
+}
+
+// ***********************************************************************************************
+// - all derived from ConstDag at compile time
+template<size_t aN_EV, size_t aN_LINK>
+struct ConstGraph
+{
+    static constexpr size_t N_WORD = (aN_EV + 63) / 64;
+
+    std::array<size_t, aN_EV + 1>        prevBegin_{};  // CSR: ev's prev = [prevBegin_[ev], prevBegin_[ev+1])
+    std::array<Domino::Event, aN_LINK>   prevEv_{};
+    std::array<bool, aN_LINK>            prevState_{};
+    std::array<size_t, aN_EV + 1>        nextBegin_{};  // CSR: ev's next = [nextBegin_[ev], nextBegin_[ev+1])
+    std::array<Domino::Event, aN_LINK>   nextEv_{};
+    std::array<Domino::Event, aN_EV>     topo_{};       // [pos]=ev; any prev before its next
+    std::array<size_t, aN_EV>            topoPos_{};    // [ev]=pos
+    std::array<Domino::Event, aN_EV>     byName_{};     // ev sorted by EvName, for getEventBy()
+    std::array<uint64_t, N_WORD>         initStates_{}; // bit[ev]=deduced state when all head F
+
+    bool linkOK_     = true;  // all link's EvName exist
+    bool nameOK_     = true;  // no dup EvName
+    bool noLoop_     = true;
+    bool noConflict_ = true;  // no same prev as both T & F
+
+    constexpr bool state(const std::array<uint64_t, N_WORD>& aStates, Domino::Event aEv) const noexcept
+        { return (aStates[aEv / 64] >> (aEv % 64)) & 1u; }
+    constexpr bool deduce(const std::array<uint64_t, N_WORD>& aStates, Domino::Event aEv) const noexcept
+    {
+        for (auto i = prevBegin_[aEv]; i < prevBegin_[aEv + 1]; ++i)
+            if (state(aStates, prevEv_[i]) != prevState_[i])  // 1 prev not satisfied
+                return false;
+        return true;
+    }
+    constexpr bool isHead(Domino::Event aEv) const noexcept { return prevBegin_[aEv] == prevBegin_[aEv + 1]; }
+};
+
+// ***********************************************************************************************
+template<size_t aN_EV, size_t aN_LINK>
+constexpr ConstGraph<aN_EV, aN_LINK> makeConstGraph(const ConstDag<aN_EV, aN_LINK>& aDag) noexcept
+{
+    ConstGraph<aN_EV, aN_LINK> g;
+
+    // resolve EvName
+    std::array<Domino::Event, aN_LINK> linkEv{};
+    std::array<Domino::Event, aN_LINK> linkPrev{};
+    for (size_t i = 0; i < aN_LINK; ++i)
+    {
+        linkEv[i]   = aDag.ev(aDag.links_[i].en_);
+        linkPrev[i] = aDag.ev(aDag.links_[i].prevEn_);
+        if (linkEv[i] == Domino::D_EVENT_FAILED_RET || linkPrev[i] == Domino::D_EVENT_FAILED_RET)
+        {
+            g.linkOK_ = false;
+            return g;
+        }
+        for (size_t j = 0; j < i; ++j)
+            if (linkEv[j] == linkEv[i] && linkPrev[j] == linkPrev[i]
+                && aDag.links_[j].prevState_ != aDag.links_[i].prevState_)
+                g.noConflict_ = false;
+    }
+
+    // CSR: count, prefix-sum, fill
+    for (size_t i = 0; i < aN_LINK; ++i)
+    {
+        ++g.prevBegin_[linkEv[i] + 1];
+        ++g.nextBegin_[linkPrev[i] + 1];
+    }
+    for (size_t ev = 0; ev < aN_EV; ++ev)
+    {
+        g.prevBegin_[ev + 1] += g.prevBegin_[ev];
+        g.nextBegin_[ev + 1] += g.nextBegin_[ev];
+    }
+    std::array<size_t, aN_EV + 1> prevFill = g.prevBegin_;
+    std::array<size_t, aN_EV + 1> nextFill = g.nextBegin_;
+    for (size_t i = 0; i < aN_LINK; ++i)
+    {
+        g.prevEv_   [prevFill[linkEv[i]]]   = linkPrev[i];
+        g.prevState_[prevFill[linkEv[i]]++] = aDag.links_[i].prevState_;
+        g.nextEv_   [nextFill[linkPrev[i]]++] = linkEv[i];
+    }
+
+    // topo order (Kahn): topo_ itself is the queue
+    std::array<size_t, aN_EV> nPrevLeft{};
+    size_t nTopo = 0;
+    for (Domino::Event ev = 0; ev < aN_EV; ++ev)
+        if ((nPrevLeft[ev] = g.prevBegin_[ev + 1] - g.prevBegin_[ev]) == 0)
+            g.topo_[nTopo++] = ev;
+    for (size_t pos = 0; pos < nTopo; ++pos)
+        for (auto i = g.nextBegin_[g.topo_[pos]]; i < g.nextBegin_[g.topo_[pos] + 1]; ++i)
+            if (--nPrevLeft[g.nextEv_[i]] == 0)
+                g.topo_[nTopo++] = g.nextEv_[i];
+    g.noLoop_ = (nTopo == aN_EV);
+    for (size_t pos = 0; pos < aN_EV; ++pos)
+        g.topoPos_[g.topo_[pos]] = pos;
+
+    // EvName index (insertion sort: N is small & compile time only)
+    for (Domino::Event ev = 0; ev < aN_EV; ++ev)
+    {
+        auto pos = ev;
+        for (; pos > 0 && constStrCmp(aDag.evNames_[g.byName_[pos - 1]], aDag.evNames_[ev]) > 0; --pos)
+            g.byName_[pos] = g.byName_[pos - 1];
+        g.byName_[pos] = ev;
+    }
+    for (size_t pos = 1; pos < aN_EV; ++pos)
+        if (constStrCmp(aDag.evNames_[g.byName_[pos - 1]], aDag.evNames_[g.byName_[pos]]) == 0)
+            g.nameOK_ = false;
+
+    // init states (like Domino deduces at setPrev(), eg prev==F -> T)
+    for (auto&& ev : g.topo_)
+        if (! g.isHead(ev) && g.deduce(g.initStates_, ev))
+            g.initStates_[ev / 64] |= uint64_t(1) << (ev % 64);
+    return g;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+class ConstDom : public UniLog
+{
+public:
+    using Event  = Domino::Event;
+    using EvName = Domino::EvName;
+    static constexpr size_t N_EV = std::remove_reference_t<decltype(aDag)>::N_EV;
+
+    explicit ConstDom(const LogName& aUniLogName = ULN_DEFAULT);
+    ~ConstDom() noexcept;
+    // - hdlr handle refers dom
+    ConstDom(const ConstDom&)            = delete;
+    ConstDom& operator=(const ConstDom&) = delete;
+
+    // - compile-time EvName -> Event, eg "constexpr auto E1 = ConstDom<DAG>::ev("e1");"
+    static constexpr Event ev(const char* aEN) noexcept { return aDag.ev(aEN); }
+    [[nodiscard]] Event getEventBy(const EvName&) const noexcept;  // binary search, no hash
+    [[nodiscard]] const char* evName(Event aEv) const noexcept { return aEv < N_EV ? aDag.evNames_[aEv] : ""; }
+
+    [[nodiscard]] bool state(const EvName& aEN) const noexcept { return state(getEventBy(aEN)); }
+    [[nodiscard]] bool state(Event aEv) const noexcept { return aEv < N_EV ? G_.state(states_, aEv) : false; }
+    size_t setState(const Domino::SimuEvents&);  // ret real changed ev#; only head (like Domino)
+    size_t setState(Event aHeadEv, bool aState) noexcept;  // 1 head w/o EvName/map: fastest
+
+    Event setHdlr(const EvName&, MsgCB aHdlr) noexcept;
+    [[nodiscard]] bool rmOneHdlrOK(const EvName&) noexcept;
+    [[nodiscard]] size_t nHdlr(const EvName& aEN) const noexcept { return nHdlr_(getEventBy(aEN)); }
+
+private:
+    using States = std::array<uint64_t, (N_EV + 63) / 64>;
+    static constexpr auto G_ = makeConstGraph(aDag);
+    static_assert(G_.linkOK_,     "(ConstDom) unknown EvName in link");
+    static_assert(G_.nameOK_,     "(ConstDom) dup EvName");
+    static_assert(G_.noLoop_,     "(ConstDom) loop in links");
+    static_assert(G_.noConflict_, "(ConstDom) same prev req both T & F");
+
+    bool pureSetStateOK_(Event aValidEv, bool aNewState, States& aDirty) noexcept;
+    void deduce_(States& aDirty) noexcept;
+    void effect_() noexcept;
+    void triggerHdlr_(Event aValidEv) noexcept;
+    size_t nHdlr_(Event aEv) const noexcept { return aEv < N_EV && hdlrs_[aEv] ? 1 : 0; }
+
+    // -------------------------------------------------------------------------------------------
+    States                            states_ = G_.initStates_;  // bit[event]=t/f
+    std::array<Event, N_EV>           effectEVs_{};  // F->T in current wave; each ev at most once
+    size_t                            nEffectEv_ = 0;
+    std::array<HdlrHandle, N_EV>      hdlrs_{};      // [event]=hdlr in HdlrSlab; 0=no hdlr
+    S_PTR<MsgSelf>                    msgSelf_ = ObjAnywhere::getObj<MsgSelf>();
+};
+
+// ***********************************************************************************************
+template<const auto& aDag>
+ConstDom<aDag>::ConstDom(const LogName& aUniLogName) : UniLog(aUniLogName)
+{
+    if (!msgSelf_)
+        throw std::runtime_error("(ConstDom) MsgSelf is required but null/absent");
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+ConstDom<aDag>::~ConstDom() noexcept
+{
+    for (auto&& hdlr : hdlrs_)
+        if (hdlr)
+            HdlrSlab::mt_inst().rmHdlrOK(hdlr);
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+void ConstDom<aDag>::deduce_(States& aDirty) noexcept
+{
+    // - bit[topo pos]: all prev deduced before ev -> 1 pass, each ev at most once
+    // - newly dirty next is always at higher pos, so re-read word after each bit
+    for (size_t word = 0; word < aDirty.size(); ++word)
+        while (aDirty[word])
+        {
+            const auto pos = word * 64 + __builtin_ctzll(aDirty[word]);
+            aDirty[word] &= aDirty[word] - 1;  // clear lowest bit
+            const auto ev = G_.topo_[pos];
+            pureSetStateOK_(ev, G_.deduce(states_, ev), aDirty);
+        }
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+void ConstDom<aDag>::effect_() noexcept
+{
+    for (size_t i = 0; i < nEffectEv_; ++i)
+        if (nHdlr_(effectEVs_[i]) > 0)
+            triggerHdlr_(effectEVs_[i]);
+    nEffectEv_ = 0;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+Domino::Event ConstDom<aDag>::getEventBy(const EvName& aEN) const noexcept
+{
+    size_t lo = 0;
+    for (size_t hi = N_EV; lo < hi; )
+    {
+        const auto mid = lo + (hi - lo) / 2;
+        if (aEN.compare(aDag.evNames_[G_.byName_[mid]]) > 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < N_EV && aEN == aDag.evNames_[G_.byName_[lo]]
+        ? G_.byName_[lo]
+        : Domino::D_EVENT_FAILED_RET;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+bool ConstDom<aDag>::pureSetStateOK_(Event aValidEv, bool aNewState, States& aDirty) noexcept
+{
+    if (G_.state(states_, aValidEv) == aNewState)
+        return false;
+
+    states_[aValidEv / 64] ^= uint64_t(1) << (aValidEv % 64);
+    TRC("(Domino) %s=%c", aDag.evNames_[aValidEv], aNewState ? 'T' : 'F');  // same fmt as Domino for dom_gantt.py
+    if (aNewState == true)
+        effectEVs_[nEffectEv_++] = aValidEv;
+    for (auto i = G_.nextBegin_[aValidEv]; i < G_.nextBegin_[aValidEv + 1]; ++i)
+    {
+        const auto nextPos = G_.topoPos_[G_.nextEv_[i]];
+        aDirty[nextPos / 64] |= uint64_t(1) << (nextPos % 64);  // dup next -> same bit: deduce once
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+bool ConstDom<aDag>::rmOneHdlrOK(const EvName& aEN) noexcept
+{
+    const auto ev = getEventBy(aEN);
+    if (nHdlr_(ev) == 0)
+        return false;
+    HdlrSlab::mt_inst().rmHdlrOK(hdlrs_[ev]);
+    hdlrs_[ev] = 0;
+    return true;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+Domino::Event ConstDom<aDag>::setHdlr(const EvName& aEN, MsgCB aHdlr) noexcept
+{
+    // validate
+    if (! aHdlr)
+    {
+        WRN("(ConstDom) Failed!!! not accept aHdlr=nullptr.");
+        return Domino::D_EVENT_FAILED_RET;
+    }
+    const auto ev = getEventBy(aEN);
+    if (ev == Domino::D_EVENT_FAILED_RET)
+    {
+        ERR("(ConstDom) Failed!!! en=" << aEN << " not in const DAG");
+        return Domino::D_EVENT_FAILED_RET;
+    }
+    if (nHdlr_(ev) > 0)
+    {
+        ERR("(ConstDom) Failed!!! Can't overwrite hdlr for " << aEN);
+        return Domino::D_EVENT_FAILED_RET;
+    }
+
+    // set & call (like HdlrDomino)
+    hdlrs_[ev] = HdlrSlab::mt_inst().newHdlr(std::move(aHdlr), ev);
+    if (state(ev) == true)
+        triggerHdlr_(ev);
+    return ev;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+size_t ConstDom<aDag>::setState(const Domino::SimuEvents& aSimuEvents)
+{
+    // validate all before set any (like Domino)
+    for (auto&& [en, state] : aSimuEvents)
+    {
+        const auto ev = getEventBy(en);
+        if (ev == Domino::D_EVENT_FAILED_RET)
+        {
+            ERR("(ConstDom) refuse since en=" << en << " not in const DAG");
+            return 0;
+        }
+        if (! G_.isHead(ev))
+        {
+            ERR("(ConstDom) refuse since en=" << en << " has prev (avoid break its prev logic)");
+            return 0;
+        }
+    }
+
+    // set ALL state(s) before deduce
+    States dirty{};  // bit[topo pos]
+    size_t nChanged = 0;
+    for (auto&& [en, state] : aSimuEvents)
+        nChanged += pureSetStateOK_(getEventBy(en), state, dirty);
+
+    deduce_(dirty);
+    effect_();  // safer to call hdlr(s) after deduce
+    return nChanged;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+size_t ConstDom<aDag>::setState(Event aHeadEv, bool aState) noexcept
+{
+    if (aHeadEv >= N_EV || ! G_.isHead(aHeadEv))
+    {
+        ERR("(ConstDom) refuse since ev=" << aHeadEv << " is invalid or has prev");
+        return 0;
+    }
+
+    States dirty{};  // bit[topo pos]
+    if (! pureSetStateOK_(aHeadEv, aState, dirty))
+        return 0;
+    deduce_(dirty);
+    effect_();
+    return 1;
+}
+
+// ***********************************************************************************************
+template<const auto& aDag>
+void ConstDom<aDag>::triggerHdlr_(Event aValidEv) noexcept
+{
+    if (!msgSelf_->newMsgOK(
+        [this, hdlr = hdlrs_[aValidEv]]() noexcept {
+            auto&& slab = HdlrSlab::mt_inst();
+            auto cb = slab.take(hdlr);
+            if (! cb)
+                return;
+            // hdlr ok -> dom ok
+            const Event validEv = slab.tag(hdlr);
+            try { cb(); }
+            catch(...) { ERR("(ConstDom) hdlr() except=" << mt_exceptInfo() << ", en=" << evName(validEv)); }
+            slab.putBack(hdlr, std::move(cb));  // no-op if hdlr rm-ed (even dom gone) in cb
+        }
+    ))
+    {
+        ERR("(ConstDom) Failed to newMsgOK for en=" << evName(aValidEv));
+    }
+}
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// ***********************************************************************************************
+// - why not derive from Domino/HdlrDomino?
+//   . their storage (vector links, unordered_map EvName) is exactly what ConstDom avoids
+//   . so same API by name (state/setState/setHdlr/rmOneHdlrOK/nHdlr), not by base class
+// - why not support newEvent()/setPrev()/rmEv?
+//   . DAG is fixed at build time; changing DAG shall use dyn Domino
+// - why "template<const auto& aDag>" than "template<ConstDag aDag>"?
+//   . class-type non-type template param needs c++20; lib is c++17
+// - why only EMsgPri_NORM hdlr (no Pri/Multi/Free)?
+//   . bring-up DAG's hdlr is 1 task/tile; add when real req
+// - why dirty bitmap (by topo pos) than Domino's stack?
+//   . each ev deduced at most once per wave (Domino may dup-deduce), no heap
+//   . ctz skips 64 clean pos per op, so a leaf change won't deduce whole DAG
@@ -0,0 +1,223 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: C++20 coroutine awaiters for domino tiles: co_await dom.risen("X") / dom.fallen("X")
+// - why:
+//   . long sequential procedure (wait A, do, wait B F, do, ...) = chain of setHdlr lambdas today
+//     . 1 hdlr (& its lambda's captures) per step, state passed step by step
+//   . coroutine: N waits = 1 frame (locals live in it), code reads top-down
+// - how:
+//   . awaiting tile X in state s = internal tile "[await] X=T/F" (prev = {X: s}), deduced by Domino
+//     . its F->T (via effect_) moves all waiting coroutines to "triggered"
+//     . then 1 msg {dom, token} (16B, no heap) resumes them, at X's priority (eg PriDomino)
+//   . no suspend if X already in s (as setHdlr calls at once)
+//   . DomTask: eager, detached procedure (frame freed at end)
+//
+// - core: ev_await_
+// - C++17: compile to nothing (whole file); CoroDom needs HdlrDomino as base
+// - class safe: yes
+//   . token in HdlrSlab (tag=await ev): on-road msg no-op after dom gone / await ev rm-ed
+//   . dom gone / await ev rm-ed: destroy waiting frames (as rm hdlr releases its captures)
+//   . coroutine shall not rm its dom (as hdlr)
+// ***********************************************************************************************
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#include <unordered_map>
+#include <vector>
+
+#include "Domino.hpp"
+#include "HdlrSlab.hpp"
+#include "UniLog.hpp"
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct DomTask
+{
+    struct promise_type
+    {
+        DomTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }  // eager: run till 1st wait
+        std::suspend_never final_suspend() noexcept { return {}; }    // detached: free frame at end
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept  // tolerate: log & end procedure (frame freed)
+        {
+            auto&& oneLog = UniLog::defaultUniLog_;
+            ERR("(DomTask) except=" << mt_exceptInfo());
+        }
+    };
+};
+
+// ***********************************************************************************************
+template<class aDominoType>
+class CoroDom : public aDominoType
+{
+public:
+    explicit CoroDom(const LogName& aUniLogName = ULN_DEFAULT) : aDominoType(aUniLogName) {}
+    ~CoroDom() noexcept override;
+
+    struct TileAwaiter
+    {
+        CoroDom*       dom_;
+        Domino::EvName en_;
+        bool           state_;
+
+        bool await_ready() const noexcept { return dom_->state(en_) == state_; }
+        void await_suspend(std::coroutine_handle<> aCoro) noexcept { dom_->wait_(en_, state_, aCoro); }
+        void await_resume() const noexcept {}
+    };
+    [[nodiscard]] TileAwaiter risen (const Domino::EvName& aEN) noexcept { return {this, aEN, true}; }
+    [[nodiscard]] TileAwaiter fallen(const Domino::EvName& aEN) noexcept { return {this, aEN, false}; }
+
+    [[nodiscard]] size_t nCoro(const Domino::EvName&) const noexcept;  // waiting & triggered on tile
+
+protected:
+    void effect_(Domino::Event aEv) noexcept override;
+    void rmEv_(Domino::Event aValidEv) noexcept override;
+
+private:
+    struct Await
+    {
+        Domino::Event tileEv_;
+        HdlrHandle    token_;  // in HdlrSlab (no cb, tag=await ev)
+        std::vector<std::coroutine_handle<>> waiting_;
+        std::vector<std::coroutine_handle<>> triggered_;  // resume msg on road
+    };
+    static Domino::EvName awaitEN_(const Domino::EvName& aEN, bool aState)
+        { return "[await] " + aEN + (aState ? "=T" : "=F"); }
+    void wait_(const Domino::EvName&, bool aState, std::coroutine_handle<>) noexcept;
+    static void cb_resume_(CoroDom*, HdlrHandle aToken) noexcept;
+    static void destroy_(Await&) noexcept;
+
+    // -------------------------------------------------------------------------------------------
+    std::unordered_map<Domino::Event, Await> ev_await_;  // [await ev]; sparse: few tiles awaited
+public:
+    using aDominoType::oneLog;
+};
+
+// ***********************************************************************************************
+template<class aDominoType>
+CoroDom<aDominoType>::~CoroDom() noexcept
+{
+    for (auto&& [ev, await] : ev_await_)
+        destroy_(await);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void CoroDom<aDominoType>::destroy_(Await& aAwait) noexcept
+{
+    HdlrSlab::mt_inst().rmHdlrOK(aAwait.token_);
+    for (auto&& coro : aAwait.waiting_)
+        coro.destroy();
+    for (auto&& coro : aAwait.triggered_)
+        coro.destroy();
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void CoroDom<aDominoType>::wait_(const Domino::EvName& aEN, bool aState, std::coroutine_handle<> aCoro) noexcept
+{
+    const auto awaitEN = awaitEN_(aEN, aState);
+    auto awaitEv = this->getEventBy(awaitEN);
+    if (awaitEv == Domino::D_EVENT_FAILED_RET)
+        awaitEv = this->setPrev(awaitEN, {{aEN, aState}});  // creates aEN if not exist
+
+    auto&& ev_await = ev_await_.find(awaitEv);
+    if (ev_await == ev_await_.end())
+        ev_await = ev_await_.emplace(awaitEv,
+            Await{this->getEventBy(aEN), HdlrSlab::mt_inst().newHdlr(MsgCB(), awaitEv), {}, {}}).first;
+    ev_await->second.waiting_.push_back(aCoro);
+    HID("(CoroDom) wait en=" << aEN << ", state=" << aState << ", nWaiting=" << ev_await->second.waiting_.size());
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void CoroDom<aDominoType>::effect_(Domino::Event aEv) noexcept
+{
+    aDominoType::effect_(aEv);
+
+    auto&& ev_await = ev_await_.find(aEv);
+    if (ev_await == ev_await_.end() || ev_await->second.waiting_.empty())
+        return;
+    auto&& await = ev_await->second;
+
+    const bool onRoad = ! await.triggered_.empty();
+    await.triggered_.insert(await.triggered_.end(), await.waiting_.begin(), await.waiting_.end());
+    await.waiting_.clear();
+    if (onRoad)
+        return;  // on-road msg resumes all
+    if (! this->msgSelf_->newMsgOK(
+        [aSelfDom = this, token = await.token_]() noexcept { cb_resume_(aSelfDom, token); },  // 16B: no heap
+        this->getPriority(await.tileEv_)
+    ))
+    {
+        ERR("(CoroDom) Failed to newMsgOK to resume en=" << this->evName_(aEv));
+    }
+}
+
+// ***********************************************************************************************
+// - static fn: aSelfDom is valid only after aToken is valid
+template<class aDominoType>
+void CoroDom<aDominoType>::cb_resume_(CoroDom* aSelfDom, HdlrHandle aToken) noexcept
+{
+    auto&& slab = HdlrSlab::mt_inst();
+    if (! slab.isValid(aToken))
+        return;
+
+    std::vector<std::coroutine_handle<>> coros;
+    coros.swap(aSelfDom->ev_await_.find(slab.tag(aToken))->second.triggered_);  // coro may wait again
+    for (auto&& coro : coros)
+        coro.resume();
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+size_t CoroDom<aDominoType>::nCoro(const Domino::EvName& aEN) const noexcept
+{
+    size_t nCoro = 0;
+    for (auto&& state : {true, false})
+    {
+        auto&& ev_await = ev_await_.find(this->getEventBy(awaitEN_(aEN, state)));
+        if (ev_await != ev_await_.end())
+            nCoro += ev_await->second.waiting_.size() + ev_await->second.triggered_.size();
+    }
+    return nCoro;
+}
+
+// ***********************************************************************************************
+// - rm await ev or its tile: destroy waiting frames
+template<class aDominoType>
+void CoroDom<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
+{
+    for (auto&& ev_await = ev_await_.begin(); ev_await != ev_await_.end();)
+    {
+        if (ev_await->first == aValidEv || ev_await->second.tileEv_ == aValidEv)
+        {
+            destroy_(ev_await->second);
+            ev_await = ev_await_.erase(ev_await);
+        }
+        else
+            ++ev_await;
+    }
+    aDominoType::rmEv_(aValidEv);
+}
+
+}  // namespace
+#endif  // __cpp_impl_coroutine
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// ***********************************************************************************************
+// - why a layer than in HdlrDomino?
+//   . C++17 users pay nothing; layer order as others, eg CoroDom<MaxDom>
+//   . getPriority() is virtual: resume at PriDomino's priority of the tile
+// - why internal "[await] X=F" tile than X's falling-edge hdlr?
+//   . X's edge/hdlr belong to its owner; await must not change them
+//   . 1 await tile per (X, state) for all coroutines: not 1 per wait
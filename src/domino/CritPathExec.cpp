@@ -0,0 +1,213 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+
+#include "CritPathExec.hpp"
+#include "ObjAnywhere.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+CritPathExec::CritPathExec(size_t aMaxParallel, const LogName& aUniLogName) noexcept
+    : UniLog(aUniLogName)
+    , dom_(aUniLogName)
+    , maxParallel_(max<size_t>(aMaxParallel, 1))
+{}
+
+// ***********************************************************************************************
+CritPathExec::~CritPathExec() noexcept
+{
+    for (auto&& task : tasks_)
+        HdlrSlab::mt_inst().rmHdlrOK(task.token_);  // on-road back -> no-op
+}
+
+// ***********************************************************************************************
+bool CritPathExec::addTaskOK(const Domino::EvName& aEN, MT_TaskEntryFN mt_aFn, CostUs aDeclaredUs,
+    const Domino::EvNames& aPrevENs) noexcept
+{
+    if (! mt_aFn || isBusy())
+    {
+        ERR("(CritPathExec) Failed!!! null fn or busy, en=" << aEN);
+        return false;
+    }
+    const auto doneEv = dom_.newEvent(aEN);
+    if (ev_task_.count(doneEv))
+    {
+        ERR("(CritPathExec) Failed!!! dup task en=" << aEN);
+        return false;
+    }
+
+    const auto idx = tasks_.size();
+    ev_task_.emplace(doneEv, idx);
+    auto&& task = tasks_.emplace_back();
+    task.mt_fn_   = move(mt_aFn);
+    task.en_      = aEN;
+    task.declUs_  = aDeclaredUs;
+    task.token_   = HdlrSlab::mt_inst().newHdlr(MsgCB(), idx);
+    if (! aPrevENs.empty())
+    {
+        Domino::SimuEvents prevs;
+        for (auto&& prevEN : aPrevENs)
+            prevs.emplace(prevEN, true);
+        for (auto&& prev : prevs)
+            task.prevENs_.push_back(prev.first);  // dedup: dup prev would run task twice
+        task.readyEv_ = dom_.setPrev("[ready] " + aEN, prevs);
+    }
+    HID("(CritPathExec) en=" << aEN << ", declUs=" << aDeclaredUs << ", nPrev=" << task.prevENs_.size());
+    return true;
+}
+
+// ***********************************************************************************************
+CritPathExec::CostUs CritPathExec::cost(const Domino::EvName& aTaskEN) const noexcept
+{
+    auto&& ev_task = ev_task_.find(dom_.getEventBy(aTaskEN));
+    return ev_task == ev_task_.end() ? 0 : tasks_[ev_task->second].costUs();
+}
+
+// ***********************************************************************************************
+// - Kahn's topo order over prev links, then rank in reverse order
+bool CritPathExec::rankOK_() noexcept
+{
+    vector<size_t> nPrev(tasks_.size(), 0);
+    for (auto&& task : tasks_)
+        task.next_.clear();
+    for (size_t idx = 0; idx < tasks_.size(); ++idx)
+    {
+        for (auto&& prevEN : tasks_[idx].prevENs_)
+        {
+            auto&& ev_task = ev_task_.find(dom_.getEventBy(prevEN));
+            if (ev_task == ev_task_.end())
+            {
+                ERR("(CritPathExec) Failed!!! unknown prev=" << prevEN << " of task idx=" << idx);
+                return false;
+            }
+            tasks_[ev_task->second].next_.push_back(idx);
+            ++nPrev[idx];
+        }
+    }
+
+    vector<size_t> topo;
+    topo.reserve(tasks_.size());
+    for (size_t idx = 0; idx < tasks_.size(); ++idx)
+        if (nPrev[idx] == 0)
+            topo.push_back(idx);
+    for (size_t i = 0; i < topo.size(); ++i)
+        for (auto&& next : tasks_[topo[i]].next_)
+            if (--nPrev[next] == 0)
+                topo.push_back(next);
+    if (topo.size() != tasks_.size())
+    {
+        ERR("(CritPathExec) Failed!!! loop in DAG, nTask=" << tasks_.size() << ", nSorted=" << topo.size());
+        return false;
+    }
+
+    for (auto&& idx = topo.rbegin(); idx != topo.rend(); ++idx)
+    {
+        auto&& task = tasks_[*idx];
+        CostUs maxNext = 0;
+        for (auto&& next : task.next_)
+            maxNext = max(maxNext, tasks_[next].rank_);
+        task.rank_ = task.costUs() + maxNext;
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+bool CritPathExec::startOK(ECritOrder aOrder) noexcept
+{
+    if (isBusy() || aOrder >= ECritOrder_MAX || ! THREAD_BACK)
+    {
+        ERR("(CritPathExec) Failed!!! busy=" << isBusy() << ", order=" << size_t(aOrder) << ", or no THREAD_BACK");
+        return false;
+    }
+    if (! rankOK_())
+        return false;
+
+    Domino::SimuEvents reset;
+    for (auto&& task : tasks_)
+        reset.emplace(task.en_, false);
+    dom_.setState(reset);
+
+    order_ = aOrder;
+    stats_ = Stats();
+    t0_    = Clock::now();
+    for (size_t idx = 0; idx < tasks_.size(); ++idx)
+        if (tasks_[idx].readyEv_ == Domino::D_EVENT_FAILED_RET)
+            pushReady_(idx);
+    dispatch_();
+    return true;
+}
+
+// ***********************************************************************************************
+void CritPathExec::pushReady_(size_t aTask) noexcept
+{
+    ready_.push(Ready{order_ == ECritOrder_CRIT_PATH ? tasks_[aTask].rank_ : 0, seq_++, aTask});
+}
+
+// ***********************************************************************************************
+void CritPathExec::dispatch_() noexcept
+{
+    auto&& threadBack = THREAD_BACK;
+    while (nRunning_ < maxParallel_ && ! ready_.empty())
+    {
+        const auto idx = ready_.top().task_;
+        ready_.pop();
+        auto&& task = tasks_[idx];
+        task.start_ = Clock::now();
+        if (! threadBack || ! threadBack->newTaskOK(
+            task.mt_fn_,  // cp: task can n-go
+            [aSelf = this, token = task.token_](SafePtr<void> aRet) noexcept {  // 16B: no heap
+                cb_taskBack_(aSelf, token, move(aRet));
+            },
+            *this
+        ))
+        {
+            ERR("(CritPathExec) Failed to start task=" << task.en_);
+            ++stats_.nFail_;
+            continue;
+        }
+        stats_.maxRunning_ = max(stats_.maxRunning_, ++nRunning_);
+    }
+    if (! isBusy())
+        stats_.usMakespan_ = chrono::duration_cast<chrono::microseconds>(Clock::now() - t0_).count();
+}
+
+// ***********************************************************************************************
+// - static fn: aSelf is valid only after aToken is valid
+void CritPathExec::cb_taskBack_(CritPathExec* aSelf, HdlrHandle aToken, SafePtr<void> aRet) noexcept
+{
+    if (HdlrSlab::mt_inst().isValid(aToken))
+        aSelf->taskBack_(HdlrSlab::mt_inst().tag(aToken), move(aRet));
+}
+
+// ***********************************************************************************************
+void CritPathExec::taskBack_(size_t aTask, SafePtr<void> aRet) noexcept
+{
+    --nRunning_;
+    auto&& task = tasks_[aTask];
+    const CostUs us = chrono::duration_cast<chrono::microseconds>(Clock::now() - task.start_).count();
+    task.histUs_ = task.histUs_ ? (task.histUs_ + us) / 2 : max<CostUs>(us, 1);
+    stats_.usBusy_ += us;
+
+    if (aRet)
+    {
+        ++stats_.nDone_;
+        dom_.setState({{task.en_, true}});
+        for (auto&& next : task.next_)
+            if (dom_.state(tasks_[next].readyEv_))  // all prev done
+                pushReady_(next);
+    }
+    else
+    {
+        ++stats_.nFail_;
+        WRN("(CritPathExec) task failed (ret=nullptr), en=" << task.en_ << ", so its next never run");
+    }
+    dispatch_();
+}
+
+}  // namespace
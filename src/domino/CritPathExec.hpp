@@ -0,0 +1,140 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - ISSUE:
+//   . HdlrDomino::setWorkerHdlr() offloads 1 task; a DAG of them (eg NE upgrade: download->verify->
+//     install->activate + many small cfg tasks) runs in FIFO order of MsgSelf
+//   . FIFO may start short side tasks 1st & delay the longest chain -> makespan = side + chain
+//
+// - how: critical-path-first list scheduling
+//   . task = done tile (head, set T when task succ) + ready tile "[ready] <task>" (prev = all its prev
+//     tasks' done tile T): Domino deduces readiness
+//   . rank = task cost + max(rank of next tasks) = longest remaining path; cost = history (avg of
+//     measured) else declared
+//   . ready task w/ highest rank 1st to THREAD_BACK (eg ThPoolBack), at most maxParallel on road
+//   . stats(): makespan, busy (sum of task time) & parallelism = busy / makespan
+//
+// - core: tasks_, ready_
+// - MT safe: no (main thread as Domino); task entry runs in ThreadBack's thread
+// - mem safe: yes; on-road task back = {this, token} (like HdlrDomino worker), invalid token after ~
+// ***********************************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "Domino.hpp"
+#include "HdlrSlab.hpp"
+#include "ThreadBack.hpp"
+
+namespace rlib
+{
+enum ECritOrder : uint8_t
+{
+    ECritOrder_CRIT_PATH,  // ready task w/ longest remaining path 1st
+    ECritOrder_FIFO,       // ready task in ready order (as HdlrDomino + MsgSelf), eg for cmp
+    ECritOrder_MAX
+};
+
+// ***********************************************************************************************
+class CritPathExec : public UniLog
+{
+public:
+    using CostUs = uint64_t;
+    struct Stats
+    {
+        size_t nDone_       = 0;  // succ task#
+        size_t nFail_       = 0;  // ret nullptr or can't start; its next task(s) never run
+        size_t maxRunning_  = 0;  // max task# on road at the same time
+        CostUs usMakespan_  = 0;  // startOK() to last task back
+        CostUs usBusy_      = 0;  // sum of all tasks' time
+        [[nodiscard]] double parallelism() const noexcept
+            { return usMakespan_ ? double(usBusy_) / double(usMakespan_) : 0; }
+    };
+
+    // @param aMaxParallel: max task# on road; 0 -> 1
+    explicit CritPathExec(size_t aMaxParallel, const LogName& = ULN_DEFAULT) noexcept;
+    ~CritPathExec() noexcept;
+
+    CritPathExec(const CritPathExec&)            = delete;
+    CritPathExec& operator=(const CritPathExec&) = delete;
+
+    // - build DAG (when ! isBusy()); aPrevENs can be added later but shall exist before startOK()
+    // - dup in aPrevENs is ignored
+    // @param aDeclaredUs: cost before any history
+    [[nodiscard]] bool addTaskOK(const Domino::EvName&, MT_TaskEntryFN, CostUs aDeclaredUs,
+        const Domino::EvNames& aPrevENs = {}) noexcept;
+
+    // - n-go: reset all done & start all head tasks; false if busy/loop/unknown prev/no THREAD_BACK
+    // - then drive by THREAD_BACK->hdlDoneFut() till ! isBusy()
+    [[nodiscard]] bool startOK(ECritOrder = ECritOrder_CRIT_PATH) noexcept;
+
+    [[nodiscard]] bool isBusy() const noexcept { return nRunning_ > 0 || ! ready_.empty(); }
+    [[nodiscard]] bool isDone(const Domino::EvName& aTaskEN) const noexcept { return dom_.state(aTaskEN); }
+    [[nodiscard]] CostUs cost(const Domino::EvName&) const noexcept;  // 0 if unknown task
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    void dispatch_() noexcept;
+    void pushReady_(size_t aTask) noexcept;
+    static void cb_taskBack_(CritPathExec*, HdlrHandle aToken, SafePtr<void>) noexcept;
+    void taskBack_(size_t aTask, SafePtr<void>) noexcept;
+    bool rankOK_() noexcept;  // false if loop
+
+    // -------------------------------------------------------------------------------------------
+    struct Task
+    {
+        MT_TaskEntryFN   mt_fn_;
+        Domino::EvNames  prevENs_;
+        Domino::EvName   en_;        // done tile
+        Domino::Event    readyEv_  = Domino::D_EVENT_FAILED_RET;  // none if head task
+        CostUs           declUs_   = 0;
+        CostUs           histUs_   = 0;  // 0=no history
+        CostUs           rank_     = 0;
+        std::vector<size_t> next_;   // next task idx(s)
+        Clock::time_point   start_;
+        HdlrHandle       token_    = 0;  // in HdlrSlab (no cb, tag=task idx)
+        CostUs costUs() const noexcept { return histUs_ ? histUs_ : declUs_; }
+    };
+    struct Ready
+    {
+        CostUs key_;  // rank (CRIT_PATH) or 0 (FIFO)
+        size_t seq_;  // ready order: tie-break
+        size_t task_;
+        bool operator<(const Ready& aR) const noexcept  // priority_queue top = max
+            { return key_ != aR.key_ ? key_ < aR.key_ : seq_ > aR.seq_; }
+    };
+
+    Domino dom_;
+    std::vector<Task> tasks_;
+    std::unordered_map<Domino::Event, size_t> ev_task_;  // [done ev]=task idx
+    std::priority_queue<Ready> ready_;
+    const size_t maxParallel_;
+    size_t nRunning_ = 0;
+    size_t seq_      = 0;
+    ECritOrder order_ = ECritOrder_CRIT_PATH;
+    Clock::time_point t0_;
+    Stats stats_;
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// 2026-10-19  CSZ       - dedup prev task(s)
+// ***********************************************************************************************
+// - why own Domino than user's?
+//   . ready/done tiles are executor internal: not pollute user dom; user polls isDone()
+// - why history = avg(old, new)?
+//   . EWMA 1/2: follow env change in few runs, no per-run storage
+// - why cost measured in main thread (start->back)?
+//   . task entry may run after executor gone; so nothing of executor shall be touched in it
+//   . maxParallel <= ThreadBack's thread# -> no queue time, only back latency (same for all tasks)
@@ -12,7 +12,10 @@
 // ***********************************************************************************************
 #pragma once
 
+#include <type_traits>
+
 #include "DataStore.hpp"
+#include "ThreadBack.hpp"
 #include "UniLog.hpp"
 #include "UniPtr.hpp"
 
@@ -94,6 +97,25 @@ template<typename aDataDominoType, typename aDataType>
 {
     return aDom.replaceDataOK(aEvName, MAKE_PTR<aDataType>(aData));
 }
+
+// ***********************************************************************************************
+// - HdlrDomino::setWorkerHdlr() + worker's ret as aDoneEN's data (set before aDoneEN=T)
+//   . so aDoneEN's hdlr reads ret by getData(aDoneEN); failed (ret=nullptr): data unchanged
+//   . aDoneEN shall not be write-ctrl (WbasicDatDom)
+template<typename aDataDominoType>
+Domino::Event setWorkerHdlrToData(aDataDominoType& aDom, const Domino::EvName& aEN, MT_TaskEntryFN mt_aWorkFN,
+    const Domino::EvName& aDoneEN) noexcept
+{
+    return aDom.setWorkerHdlr(aEN, std::move(mt_aWorkFN), aDoneEN,
+        [&aDom, aDoneEN](SafePtr<void> aRet) {  // dom alive: on-road ret is dropped if dom gone
+            if (! aRet)
+                return;
+            if constexpr (std::is_same_v<S_PTR<void>, SafePtr<void>>)
+                (void)aDom.replaceDataOK(aDoneEN, std::move(aRet));
+            else
+                (void)aDom.replaceDataOK(aDoneEN, aRet.get());
+        });
+}
 }  // namespace
 // ***********************************************************************************************
 // YYYY-MM-DD  Who       v)Modification Description
@@ -113,4 +135,5 @@ template<typename aDataDominoType, typename aDataType>
 // 2024-06-08  CSZ       5)use DataStore instead of map
 // 2025-02-13  CSZ       - support both SafePtr & shared_ptr
 // 2025-03-29  CSZ       6)tolerate exception
+// 2026-10-19  CSZ       - worker's ret as data
 // ***********************************************************************************************
@@ -0,0 +1,162 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: tile deadline: "X not T within N ms" -> timeout tile T (eg chain to failure/rollback)
+// - why:
+//   . nearly every upgrade step needs 1; today 1 ext timer per tile + usr glue to setState
+// - how:
+//   . setDeadline() arms 1 timer by MSG_SELF->armTimer() (O(1)); X's F->T (effect_) cancels it (O(1))
+//   . expire: X still F -> setState(timeout tile T) in MSG_SELF->handleXxx() (main thread)
+//   . so main loop's MSG_SELF->timedwait()/waitNs() wakes up by deadline, no extra wheel to drive
+//   . bit col hasDeadlineCol_: effect_() of ev w/o deadline costs 1 bit test, no hash
+//
+// - core: ev_deadline_
+// - class safe: yes
+//   . ~DeadlineDom / rm ev cancel timer: wheel never calls a gone dom
+//   . timeout tile shall be chain head (as setState)
+// ***********************************************************************************************
+#pragma once
+
+#include <unordered_map>
+
+#include "Domino.hpp"
+#include "MsgSelf.hpp"
+#include "ObjAnywhere.hpp"
+#include "UniLog.hpp"
+
+namespace rlib
+{
+// ***********************************************************************************************
+template<class aDominoType>
+class DeadlineDom : public aDominoType
+{
+public:
+    explicit DeadlineDom(const LogName& aUniLogName = ULN_DEFAULT) : aDominoType(aUniLogName) {}
+    ~DeadlineDom() noexcept override;
+
+    // - (re-)arm: aEN shall be T within aMs, else aTimeoutEN=T; no arm if aEN already T
+    // - 1 deadline per ev; fail if no MSG_SELF
+    Domino::Event setDeadline(const Domino::EvName& aEN, size_t aMs, const Domino::EvName& aTimeoutEN) noexcept;
+    bool rmDeadlineOK(const Domino::EvName& aEN) noexcept { return rmDeadlineOK_(this->getEventBy(aEN)); }
+    [[nodiscard]] bool hasDeadline(const Domino::EvName& aEN) const noexcept
+        { return this->bitAttr_(hasDeadlineCol_, this->getEventBy(aEN)); }
+
+protected:
+    void effect_(Domino::Event aEv) noexcept override;
+    void rmEv_(Domino::Event aValidEv) noexcept override;
+    bool rmDeadlineOK_(Domino::Event aEv) noexcept;
+
+private:
+    void timeout_(Domino::Event aValidEv) noexcept;
+
+    // -------------------------------------------------------------------------------------------
+    struct Deadline
+    {
+        TimerHandle    timer_;
+        Domino::EvName timeoutEN_;
+    };
+    std::unordered_map<Domino::Event, Deadline> ev_deadline_;  // sparse: few ev armed at a time
+    const Domino::AttrCol hasDeadlineCol_ = this->newBitAttr_();  // [event]=in ev_deadline_
+    S_PTR<MsgSelf> timerOwner_;  // at 1st setDeadline(): same MsgSelf to cancel
+public:
+    using aDominoType::oneLog;
+};
+
+// ***********************************************************************************************
+template<class aDominoType>
+DeadlineDom<aDominoType>::~DeadlineDom() noexcept
+{
+    for (auto&& [ev, deadline] : ev_deadline_)
+        timerOwner_->disarmTimerOK(deadline.timer_);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+Domino::Event DeadlineDom<aDominoType>::setDeadline(const Domino::EvName& aEN, size_t aMs,
+    const Domino::EvName& aTimeoutEN) noexcept
+{
+    if (! timerOwner_)
+        timerOwner_ = MSG_SELF;
+    if (! timerOwner_)
+    {
+        ERR("(DeadlineDom) Failed!!! no MSG_SELF for en=" << aEN);
+        return Domino::D_EVENT_FAILED_RET;
+    }
+
+    const auto ev = this->newEvent(aEN);
+    rmDeadlineOK_(ev);  // re-arm
+    if (this->state(ev))
+    {
+        HID("(DeadlineDom) en=" << aEN << " already T, no deadline");
+        return ev;
+    }
+    this->newEvent(aTimeoutEN);
+    ev_deadline_.emplace(ev, Deadline{
+        timerOwner_->armTimer(std::chrono::milliseconds(aMs),
+            [aSelfDom = this, ev]() noexcept { aSelfDom->timeout_(ev); }),  // 16B: no heap
+        aTimeoutEN});
+    this->setBitAttr_(hasDeadlineCol_, ev, true);
+    HID("(DeadlineDom) en=" << aEN << ", ms=" << aMs << ", timeoutEN=" << aTimeoutEN);
+    return ev;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+bool DeadlineDom<aDominoType>::rmDeadlineOK_(Domino::Event aEv) noexcept
+{
+    if (! this->bitAttr_(hasDeadlineCol_, aEv))
+        return false;
+
+    auto&& ev_deadline = ev_deadline_.find(aEv);
+    timerOwner_->disarmTimerOK(ev_deadline->second.timer_);
+    ev_deadline_.erase(ev_deadline);
+    this->setBitAttr_(hasDeadlineCol_, aEv, false);
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void DeadlineDom<aDominoType>::effect_(Domino::Event aEv) noexcept
+{
+    aDominoType::effect_(aEv);
+    if (this->state(aEv))  // in time
+        rmDeadlineOK_(aEv);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void DeadlineDom<aDominoType>::timeout_(Domino::Event aValidEv) noexcept
+{
+    auto&& ev_deadline = ev_deadline_.find(aValidEv);
+    const auto timeoutEN = std::move(ev_deadline->second.timeoutEN_);
+    ev_deadline_.erase(ev_deadline);  // timer already expired
+    this->setBitAttr_(hasDeadlineCol_, aValidEv, false);
+
+    if (this->state(aValidEv))
+        return;  // eg T w/o effect_ (falling-edge only)
+    WRN("(DeadlineDom) timeout en=" << this->evName_(aValidEv) << ", so set " << timeoutEN << "=T");
+    this->setState({{timeoutEN, true}});
+}
+
+// ***********************************************************************************************
+template<typename aDominoType>
+void DeadlineDom<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
+{
+    rmDeadlineOK_(aValidEv);
+    aDominoType::rmEv_(aValidEv);
+}
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// 2026-10-19  CSZ       - arm in MsgSelf's wheel than TIMER_WHEEL: deadline fires w/o extra drive
+// ***********************************************************************************************
+// - why arm by usr than auto on X's prev all T?
+//   . step "start" differs (eg hdlr sent a req); usr arms in that hdlr, so deadline = step's own time
+// - why timeout tile than a cb?
+//   . stays in domino: chain failure/rollback tiles & hdlrs as any other tile
@@ -15,6 +15,13 @@ namespace rlib
 {
 static const Domino::EVs defaultEvPeers;  // internal use only
 
+// ***********************************************************************************************
+Domino::~Domino() noexcept
+{
+    if (feed_)
+        feed_->detach(this);  // feed may outlive dom (shared w/ consumer)
+}
+
 // ***********************************************************************************************
 void Domino::deduceStateFrom_(Event aValidEv) noexcept
 {
@@ -44,7 +51,7 @@ void Domino::deduceStateFrom_(Event aValidEv) noexcept
 bool Domino::deduceStateSelf_(Event aValidEv, bool aPrevType) const noexcept
 {
     for (auto&& prevEV : findPeerEVs(aValidEv, prev_[aPrevType]))
-        if (states_[prevEV] != aPrevType)  // 1 prev not satisfied
+        if (state_(prevEV) != aPrevType)  // 1 prev not satisfied
             return false;
     return true;
 }
@@ -52,12 +59,82 @@ bool Domino::deduceStateSelf_(Event aValidEv, bool aPrevType) const noexcept
 // ***********************************************************************************************
 void Domino::effect_() noexcept
 {
-    for (auto&& ev : effectEVs_)
-        if (states_[ev] == true)  // avoid multi-change; skip bounds check since effectEVs_ are validated
-            effect_(ev);
+    if (! effectEVs_.empty())
+    {
+        inWave_ = true;
+        if (staticWave_)
+            staticWave_(*this, effectEVs_);  // same loop w/ static effect_()
+        else
+            for (auto&& ev : effectEVs_)
+                if (isEffectEdge_(ev))  // avoid multi-change; skip bounds check since effectEVs_ are validated
+                    effect_(ev);
+        inWave_ = false;
+        effectWaveEnd_();
+    }
     decltype(effectEVs_)().swap(effectEVs_);  // may safer & faster than clear()
 }
 
+// ***********************************************************************************************
+bool Domino::bitAttr_(AttrCol aCol, Event aEv) const noexcept
+{
+    if (aEv >= nEv_() || aCol >= nBitAttr_)
+        return false;
+    return (bitAttrs_[aEv / 64 * nBitAttr_ + aCol] >> (aEv % 64)) & 1u;
+}
+
+// ***********************************************************************************************
+uint8_t Domino::byteAttr_(AttrCol aCol, Event aEv) const noexcept
+{
+    return aEv < nEv_() && aCol < nByteAttr_
+        ? byteAttrs_[aEv * nByteAttr_ + aCol]
+        : 0;
+}
+
+// ***********************************************************************************************
+// - group's bits beyond states_ (impossible unless mask from other dom) are F
+bool Domino::allTrue(const EvMask& aGroup) const noexcept
+{
+    const auto nWord = min(aGroup.size(), states_.size());
+    for (size_t i = 0; i < nWord; ++i)
+        if ((aGroup[i] & ~states_[i]) != 0)
+            return false;
+    for (size_t i = nWord; i < aGroup.size(); ++i)
+        if (aGroup[i] != 0)
+            return false;
+    return true;
+}
+
+// ***********************************************************************************************
+size_t Domino::countFalse(const EvMask& aGroup) const noexcept
+{
+    size_t n = 0;
+    for (auto&& word : aGroup)
+        n += __builtin_popcountll(word);
+    return n - countTrue(aGroup);
+}
+
+// ***********************************************************************************************
+size_t Domino::countTrue(const EvMask& aGroup) const noexcept
+{
+    size_t n = 0;
+    const auto nWord = min(aGroup.size(), states_.size());
+    for (size_t i = 0; i < nWord; ++i)
+        n += __builtin_popcountll(aGroup[i] & states_[i]);
+    return n;
+}
+
+// ***********************************************************************************************
+Domino::EVs Domino::diff(const EvMask& aOld, const EvMask& aNew) noexcept
+{
+    EVs changedEVs;
+    const auto& longer = aOld.size() > aNew.size() ? aOld : aNew;
+    const auto nWord = min(aOld.size(), aNew.size());
+    for (size_t i = 0; i < longer.size(); ++i)
+        for (auto word = (i < nWord ? aOld[i] ^ aNew[i] : longer[i]); word; word &= word - 1)  // clear lowest bit
+            changedEVs.push_back(i * 64 + __builtin_ctzll(word));
+    return changedEVs;
+}
+
 // ***********************************************************************************************
 Domino::EvNames Domino::evNames() const noexcept
 {
@@ -68,6 +145,15 @@ Domino::EvNames Domino::evNames() const noexcept
     return names;
 }
 
+// ***********************************************************************************************
+Domino::Event Domino::firstFalse(const EvMask& aGroup) const noexcept
+{
+    for (size_t i = 0; i < aGroup.size(); ++i)
+        if (const auto falseBits = aGroup[i] & ~(i < states_.size() ? states_[i] : 0))
+            return i * 64 + __builtin_ctzll(falseBits);
+    return D_EVENT_FAILED_RET;
+}
+
 // ***********************************************************************************************
 const Domino::EVs& Domino::findPeerEVs(Event aEv, const EvLinks& aLinks) noexcept
 {
@@ -99,21 +185,67 @@ Domino::Event Domino::newEvent(const EvName& aEvName) noexcept
     // new from rm-ed
     newEv = recycleEv_();
     if (newEv == D_EVENT_FAILED_RET)
-        newEv = states_.size();
+        newEv = nEv_();
 
     HID("(Domino) init new EvName=" << aEvName << ", event=" << newEv);
     en_ev_[aEvName] = newEv;
-    if (newEv >= states_.size()) {
-        states_.push_back(false);  // create new slot
+    if (newEv >= nEv_()) {
+        if (newEv % 64 == 0) {
+            states_.push_back(0);  // create new slot(s) for 64 ev
+            bitAttrs_.resize(bitAttrs_.size() + nBitAttr_);
+        }
+        byteAttrs_.resize(byteAttrs_.size() + nByteAttr_);
         ev_en_.emplace_back();  // allocate space
         for (auto& link : prev_) link.emplace_back();
         for (auto& link : next_) link.emplace_back();
     }
     ev_en_[newEv] = aEvName;
+    if (feed_)
+        feed_->newEv(newEv);  // size here than in hot pureSetStateOK_()
 
     return newEv;
 }
 
+// ***********************************************************************************************
+// - normally called in layer's constructor (no ev yet); else re-layout existing rows (rare)
+Domino::AttrCol Domino::newBitAttr_() noexcept
+{
+    if (! states_.empty())
+    {
+        EvMask newAttrs(states_.size() * (nBitAttr_ + 1));  // except eg bad_alloc: can't recover->terminate
+        for (size_t word = 0; word < states_.size(); ++word)
+            copy_n(&bitAttrs_[word * nBitAttr_], nBitAttr_, &newAttrs[word * (nBitAttr_ + 1)]);
+        bitAttrs_.swap(newAttrs);
+    }
+    return nBitAttr_++;
+}
+
+// ***********************************************************************************************
+Domino::AttrCol Domino::newByteAttr_() noexcept
+{
+    if (nEv_() > 0)
+    {
+        vector<uint8_t> newAttrs(nEv_() * (nByteAttr_ + 1));  // except eg bad_alloc: can't recover->terminate
+        for (size_t ev = 0; ev < nEv_(); ++ev)
+            copy_n(&byteAttrs_[ev * nByteAttr_], nByteAttr_, &newAttrs[ev * (nByteAttr_ + 1)]);
+        byteAttrs_.swap(newAttrs);
+    }
+    return nByteAttr_++;
+}
+
+// ***********************************************************************************************
+Domino::EvMask Domino::newMask(const EvNames& aEvNames) noexcept
+{
+    EvMask group;
+    for (auto&& en : aEvNames)
+    {
+        const auto ev = newEvent(en);
+        group.resize(max(group.size(), ev / 64 + 1));  // except eg bad_alloc: can't recover->terminate
+        group[ev / 64] |= uint64_t(1) << (ev % 64);
+    }
+    return group;
+}
+
 // ***********************************************************************************************
 void Domino::pureRmLink_(Event aValidEv, EvLinks& aMyLinks, EvLinks& aNeighborLinks) noexcept
 {
@@ -164,11 +296,13 @@ void Domino::pureSetPrev_(Event aValidEv, const SimuEvents& aSimuPrevEvents) noe
 // ***********************************************************************************************
 bool Domino::pureSetStateOK_(Event aValidEv, const bool aNewState) noexcept
 {
-    if (states_[aValidEv] != aNewState)  // do need change
+    if (state_(aValidEv) != aNewState)  // do need change
     {
-        states_[aValidEv] = aNewState;
+        states_[aValidEv / 64] ^= uint64_t(1) << (aValidEv % 64);
         TRC("(Domino) %s=%c", evName_(aValidEv).c_str(), aNewState ? 'T' : 'F');
-        if (aNewState == true)
+        if (feed_)
+            feed_->push(aValidEv, aNewState);
+        if (aNewState ? effectOnRise_(aValidEv) : effectOnFall_(aValidEv))
             effectEVs_.push_back(aValidEv);
         return true;
     }
@@ -191,6 +325,11 @@ void Domino::rmEv_(Event aValidEv) noexcept
 
     // rm self resrc
     pureSetStateOK_(aValidEv, false);  // must before clean ev_en_
+    for (size_t col = 0; col < nBitAttr_; ++col)
+        setBitAttr_(col, aValidEv, false);
+    fill_n(byteAttrs_.begin() + aValidEv * nByteAttr_, nByteAttr_, 0);
+    if (feed_)
+        feed_->rmEv(aValidEv);  // after pureSetStateOK_(): its F keeps old nRun
     en_ev_.erase(evName_(aValidEv));
     ev_en_[aValidEv].clear();
     HID("[Domino] ev=" << aValidEv);
@@ -211,7 +350,7 @@ Domino::Event Domino::setPrev(const EvName& aEvName, const SimuEvents& aSimuPrev
     const auto fromEv = newEvent(aEvName);  // complex by getEventBy(), not worth
     // - compute all nextable events from fromEv once for all aSimuPrevEvents
     // - vector<bool>/bit is safer than unordered_set when huge nexts
-    vector<bool> nextable(states_.size() + aSimuPrevEvents.size(), false);  // reserve & init; tmp container
+    vector<bool> nextable(nEv_() + aSimuPrevEvents.size(), false);  // reserve & init; tmp container
     {
         stack<Event> evStack;
         nextable[fromEv] = true;
@@ -257,6 +396,35 @@ Domino::Event Domino::setPrev(const EvName& aEvName, const SimuEvents& aSimuPrev
     return fromEv;
 }
 
+// ***********************************************************************************************
+bool Domino::setChangeFeedOK(shared_ptr<MtChangeFeed> aFeed) noexcept
+{
+    if (aFeed && aFeed != feed_ && ! aFeed->attachOK(this, nEv_()))
+    {
+        ERR("(Domino) failed!!! feed is attached to another dom (DomChange has no dom id)");
+        return false;
+    }
+    if (feed_ && feed_ != aFeed)
+        feed_->detach(this);
+    feed_ = move(aFeed);
+    return true;
+}
+
+// ***********************************************************************************************
+void Domino::setEffectEdge_(Event aValidEv, bool aRise, bool aFall) noexcept
+{
+    setBitAttr_(noRiseCol_, aValidEv, ! aRise);
+    setBitAttr_(fallCol_,   aValidEv, aFall);
+}
+
+// ***********************************************************************************************
+void Domino::setBitAttr_(AttrCol aCol, Event aValidEv, bool aVal) noexcept
+{
+    auto&& word = bitAttrs_[aValidEv / 64 * nBitAttr_ + aCol];
+    const auto mask = uint64_t(1) << (aValidEv % 64);
+    word = aVal ? (word | mask) : (word & ~mask);
+}
+
 // ***********************************************************************************************
 size_t Domino::setState(const SimuEvents& aSimuEvents)
 {
@@ -327,7 +495,7 @@ void Domino::whyFalse_(WhyStep& aStep) const noexcept
     for (auto curEV = aStep.curEV_;; curEV = *it) {
         auto&& prevEVs = findPeerEVs(curEV, prev_[true]);
         it = find_if(prevEVs.begin(), prevEVs.end(),
-            [this](auto&& aPrevEV) noexcept { return states_[aPrevEV] == false; });
+            [this](auto&& aPrevEV) noexcept { return state_(aPrevEV) == false; });
         if (it == prevEVs.end()) {  // nothing in true-prev
             if (curEV == aStep.curEV_) {
                 break;  // try false-prev
@@ -342,7 +510,7 @@ void Domino::whyFalse_(WhyStep& aStep) const noexcept
     // search false prev
     auto&& prevEVs = findPeerEVs(aStep.curEV_, prev_[false]);
     it = find_if(prevEVs.begin(), prevEVs.end(),
-        [this](auto&& aPrevEV) noexcept { return states_[aPrevEV] == true; });
+        [this](auto&& aPrevEV) noexcept { return state_(aPrevEV) == true; });
     if (it == prevEVs.end()) {  // nothing in false-prev
         HID("(Domino) found true en=" << evName_(aStep.curEV_) << " from false prevEVs=" << prevEVs.size());
         aStep.resultEN_ = evName_(aStep.curEV_) + "==false";
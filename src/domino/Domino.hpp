@@ -14,7 +14,7 @@
 //   . whenever an event occurred, following event(s) can be auto-triggered, so on calling hdlr(s)
 //   . this will go till end (like domino)
 // - clarify:
-//   . each event-hdlr is called only when event state F->T
+//   . each event-hdlr is called only when event state F->T (default; T->F or both is opt-in per ev)
 //   . 1-go domino is like SW upgrade - 1-go then discard, next will use new domino
 //     . n-go domino is like IM - repeat working till reboot
 //     . after 2024-03-19 domino supports n-go
@@ -45,12 +45,15 @@
 // ***********************************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <stack>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "MtChangeFeed.hpp"
 #include "UniLog.hpp"
 
 namespace rlib
@@ -67,6 +70,7 @@ public:
     using SimuEvents = std::map<EvName, bool>;  // not unordered-map: small ele#, most traversal
     using EvNames    = std::vector<EvName>;  // [event]=evName; better perf & less mem than unordered_set
     using EvLinks    = std::vector<EVs>;  // [event]=peers; better perf & less mem than unordered_set
+    using EvMask     = std::vector<uint64_t>;  // bit[event]=in group/T; word-wide ops (popcount/ctz)
 
     enum : Event
     {
@@ -82,7 +86,7 @@ public:
     // - prev:   prev tile(s)        , optional
     // -------------------------------------------------------------------------------------------
     explicit Domino(const LogName& aUniLogName = ULN_DEFAULT) noexcept : UniLog(aUniLogName) {}
-    virtual ~Domino() noexcept = default;
+    virtual ~Domino() noexcept;
     // - avoid slicing
     Domino(const Domino&)            = delete;
     Domino& operator=(const Domino&) = delete;
@@ -92,21 +96,68 @@ public:
     [[nodiscard]] EvNames evNames() const noexcept;
 
     [[nodiscard]] bool state(const EvName& aEvName) const noexcept { return state(getEventBy(aEvName)); }
-    [[nodiscard]] bool state(Event aEv) const noexcept { return aEv < states_.size() ? states_[aEv] : false; }
+    [[nodiscard]] bool state(Event aEv) const noexcept { return aEv < nEv_() ? state_(aEv) : false; }
     size_t setState(const SimuEvents&);  // ret real changed ev#
 
     Event  setPrev(const EvName&, const SimuEvents&) noexcept;  // be careful not create eg ttue-false loop
     [[nodiscard]] EvName whyFalse(Event) const noexcept;  // debug only; read-only API - no hurt if fake Event
 
+    // - bulk state query: 64 events per op than per-EvName state()
+    //   . group = EvMask prebuilt once (create unexist ev like setPrev); rebuild after rm ev
+    //   . snapshot() = all states now; diff() between 2 snapshots
+    [[nodiscard]] EvMask newMask(const EvNames&) noexcept;
+    [[nodiscard]] EvMask snapshot() const noexcept { return states_; }
+    [[nodiscard]] bool   allTrue   (const EvMask& aGroup) const noexcept;
+    [[nodiscard]] size_t countTrue (const EvMask& aGroup) const noexcept;
+    [[nodiscard]] size_t countFalse(const EvMask& aGroup) const noexcept;
+    [[nodiscard]] Event  firstFalse(const EvMask& aGroup) const noexcept;  // D_EVENT_FAILED_RET if none
+    [[nodiscard]] static EVs diff(const EvMask& aOld, const EvMask& aNew) noexcept;  // changed ev(s), ascending
+
+    // - opt-in: each state change -> aFeed (binary record) for other thread; nullptr=off
+    // - shared_ptr than S_PTR: feed is shared cross thread
+    // - false: aFeed attached to another dom (DomChange has no dom id)
+    [[nodiscard]] bool setChangeFeedOK(std::shared_ptr<MtChangeFeed> aFeed) noexcept;
+
 protected:
     const EvName& evName_(Event aValidEv) const noexcept { return ev_en_[aValidEv]; }
     virtual void  effect_(Event) noexcept {}  // can't const since FreeDom will rm hdlr
+    // - after each wave: eg HdlrDomino posts batched hdlrs; isInWave_() to know if in wave's effect_()
+    virtual void  effectWaveEnd_() noexcept {}
+    bool          isInWave_() const noexcept { return inWave_; }
+
+    // - static composition (see StaticDom): final type for layers' static call; void=dynamic (virtual)
+    // - aWaveFN: 1 call per wave to a loop of static effect_() (than 1 virtual per ev); null=dynamic
+    using FinalType = void;
+    using WaveFN    = void (*)(Domino&, const EVs& aEffectEVs) noexcept;
+    void setStaticWave_(WaveFN aWaveFN) noexcept { staticWave_ = aWaveFN; }
+
+    // - edge(s) of an ev to effect_(): default F->T only; T->F opt-in (eg HdlrDomino's falling-edge hdlr)
+    //   . 2 bit cols than mirror "not-X" ev: no extra ev/link/deduce
+    void setEffectEdge_(Event aValidEv, bool aRise, bool aFall) noexcept;
+    bool effectOnRise_(Event aEv) const noexcept { return ! bitAttr_(noRiseCol_, aEv); }
+    bool effectOnFall_(Event aEv) const noexcept { return bitAttr_(fallCol_, aEv); }
+    bool isEffectEdge_(Event aValidEv) const noexcept  // cur state is an edge to effect_()?
+        { return state_(aValidEv) ? effectOnRise_(aValidEv) : effectOnFall_(aValidEv); }
 
     // - rm self dom's resource (RISK: aEv's leaf(s) may become orphan!!!)
     // - virtual for each dom: MUST call aDominoType::rmEv_() to chain base cleanup
     virtual void  rmEv_(Event aValidEv) noexcept;
     virtual Event recycleEv_() noexcept { return D_EVENT_FAILED_RET; }
-    virtual bool  isRemoved(Event aEv) const noexcept { return aEv >= states_.size(); }
+    virtual bool  isRemoved(Event aEv) const noexcept { return aEv >= nEv_(); }
+
+    // - per-ev attr column store for all template layers (eg FreeHdlrDom's isRepeat, PriDom's pri)
+    //   . layer registers column(s) in its constructor, then get/set by ret AttrCol
+    //   . dense: grow in newEvent() & clear in rmEv_() all columns in 1 pass (layer needn't override rmEv_)
+    //   . bit col: 1 bit/ev; byte col: 1 byte/ev; default=0 (both before set & after rm ev)
+    //   . sparse attr (eg DataDomino's data) keeps its own container
+    using AttrCol = size_t;
+    AttrCol newBitAttr_() noexcept;
+    AttrCol newByteAttr_() noexcept;
+    bool    bitAttr_ (AttrCol aCol, Event aEv) const noexcept;
+    uint8_t byteAttr_(AttrCol aCol, Event aEv) const noexcept;
+    void setBitAttr_ (AttrCol aCol, Event aValidEv, bool aVal) noexcept;
+    void setByteAttr_(AttrCol aCol, Event aValidEv, uint8_t aVal) noexcept
+        { byteAttrs_[aValidEv * nByteAttr_ + aCol] = aVal; }
 
 private:
     void deduceStateFrom_(Event aValidEv) noexcept;
@@ -123,8 +174,19 @@ private:
 
     static const EVs& findPeerEVs(Event, const EvLinks&) noexcept;
 
+    size_t nEv_() const noexcept { return ev_en_.size(); }
+    bool state_(Event aValidEv) const noexcept { return (states_[aValidEv / 64] >> (aValidEv % 64)) & 1u; }
+
     // -------------------------------------------------------------------------------------------
-    std::vector<bool> states_;  // bitmap & dyn expand, [event]=t/f
+    EvMask states_;  // bitmap & dyn expand, bit[event]=t/f; not vector<bool>: need word access
+
+    // - row-major: 1 ev's all attrs in 1 cache line
+    EvMask               bitAttrs_;       // [ev/64 * nBitAttr_ + col] = 64 ev's bits of col
+    std::vector<uint8_t> byteAttrs_;      // [ev * nByteAttr_ + col]
+    size_t               nBitAttr_  = 0;  // column#
+    size_t               nByteAttr_ = 0;
+    const AttrCol        noRiseCol_ = newBitAttr_();  // default 0 = effect on F->T
+    const AttrCol        fallCol_   = newBitAttr_();
 
     EvLinks  prev_[N_EVENT_STATE];  // [event]=peers
     EvLinks  next_[N_EVENT_STATE];  // [event]=peers
@@ -132,6 +194,10 @@ private:
     std::unordered_map<EvName, Event> en_ev_;  // [evName]=event; event# may huge
     EvNames                           ev_en_;  // [event]=evName
     EVs                               effectEVs_;
+    bool                              inWave_ = false;
+    WaveFN                            staticWave_ = nullptr;
+
+    std::shared_ptr<MtChangeFeed> feed_;  // null=off (most case)
 };
 
 }  // namespace
@@ -182,6 +248,13 @@ private:
 // 2024-03-19  CSZ       9)1-go domino -> n-go domino
 // 2025-03-31  CSZ       10)tolerate exception; rm recursion
 // 2026-04-06  CSZ       11)max perf + min mem/ev
+// 2026-10-18  CSZ       - opt-in change feed for other thread
+//                       - bulk state query
+//                       - attr column store for template layers
+//                       - effectWaveEnd_() for batch hdlr
+//                       - T->F effect_() opt-in per ev
+// 2026-10-19  CSZ       - 1 change feed per dom
+//                       - static composition hooks for StaticDom
 // ***********************************************************************************************
 // - where:
 //   . start using domino for time-cost events
@@ -20,8 +20,6 @@
 // ***********************************************************************************************
 #pragma once
 
-#include <vector>
-
 namespace rlib
 {
 // ***********************************************************************************************
@@ -35,44 +33,42 @@ public:
     [[nodiscard]] bool isRepeatHdlr(Domino::Event) const noexcept;
 
 protected:
-    void triggerHdlr_(const SharedMsgCB& aValidHdlr, Domino::Event aValidEv) noexcept override;
-
-    void rmEv_(Domino::Event aValidEv) noexcept override;
-
-    static void cb_hdlr_(FreeHdlrDomino*, Domino::Event, const WeakMsgCB&) noexcept;
+    void callHdlr_(HdlrHandle aValidHdlr) noexcept override;
 private:
-    // - bitmap & dyn expand, [event]=t/f
+    // - bit column in Domino's attr store, [event]=t/f; auto clear when rm ev
     // - don't know if repeated hdlrs are much less than non-repeated, so bitmap is simpler than set<Event>
-    std::vector<bool> isRepeatHdlr_;
+    const Domino::AttrCol repeatCol_ = this->newBitAttr_();
 public:
     using aDominoType::oneLog;
 };
 
 // ***********************************************************************************************
-// - static, & aSelfDom than "this": avoid deref invalid "this" at very beginning of cb_hdlr_()
-// - member fn: FreeHdlrDomino* is a template
+// - called in msg only when aValidHdlr valid (so dom ok)
 template<class aDominoType>
-void FreeHdlrDomino<aDominoType>::cb_hdlr_(FreeHdlrDomino* aSelfDom, Domino::Event aValidEv, const WeakMsgCB& aWeakHdlr) noexcept
+void FreeHdlrDomino<aDominoType>::callHdlr_(HdlrHandle aValidHdlr) noexcept
 {
-    auto hdlr = aWeakHdlr.lock();
-    if (! hdlr)
+    auto&& slab = HdlrSlab::mt_inst();
+    const Domino::Event validEv = slab.tag(aValidHdlr);
+    if (isRepeatHdlr(validEv))  // flag can't change when hdlr exist, so same as decide at trigger
+    {
+        aDominoType::callHdlr_(aValidHdlr);
         return;
-    // hdlr ok -> aFreeDom.map ok -> aFreeDom ok
-    aSelfDom->rmOneHdlrOK_(aValidEv, hdlr);
-    try { (*(hdlr.get()))(); }
-    catch(...) {
-        auto& oneLog = *aSelfDom;
-        ERR("(FreeHdlrDom) hdlr() except=" << mt_exceptInfo() << ", en=" << aSelfDom->evName_(aValidEv));
     }
+
+    auto hdlr = slab.take(aValidHdlr);
+    if (! hdlr)
+        return;
+    HID("(FreeHdlrDom) rm-then-call for en=" << this->evName_(validEv));
+    this->rmOneHdlrOK_(validEv, aValidHdlr);  // hdlr is out of slab so safe to rm
+    try { hdlr(); }
+    catch(...) { ERR("(FreeHdlrDom) hdlr() except=" << mt_exceptInfo() << ", en=" << this->evName_(validEv)); }
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
 bool FreeHdlrDomino<aDominoType>::isRepeatHdlr(Domino::Event aEv) const noexcept
 {
-    return aEv < isRepeatHdlr_.size()
-        ? isRepeatHdlr_[aEv]
-        : false;
+    return this->bitAttr_(repeatCol_, aEv);
 }
 
 // ***********************************************************************************************
@@ -88,45 +84,10 @@ Domino::Event FreeHdlrDomino<aDominoType>::repeatedHdlr(const Domino::EvName& aE
 
     // set flag
     auto&& newEv = this->newEvent(aEvName);
-    if (newEv >= isRepeatHdlr_.size())
-        isRepeatHdlr_.resize(newEv + 1);
-    isRepeatHdlr_[newEv] = isRepeated;
+    this->setBitAttr_(repeatCol_, newEv, isRepeated);
     return newEv;
 }
 
-// ***********************************************************************************************
-template<typename aDominoType>
-void FreeHdlrDomino<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
-{
-    if (aValidEv < isRepeatHdlr_.size())
-        isRepeatHdlr_[aValidEv] = false;
-
-    aDominoType::rmEv_(aValidEv);
-}
-
-// ***********************************************************************************************
-template<class aDominoType>
-void FreeHdlrDomino<aDominoType>::triggerHdlr_(const SharedMsgCB& aValidHdlr, Domino::Event aValidEv) noexcept
-{
-    // repeated hdlr
-    if (isRepeatHdlr(aValidEv))
-    {
-        aDominoType::triggerHdlr_(aValidHdlr, aValidEv);
-        return;
-    }
-
-    HID("(FreeHdlrDom) trigger a rm-then-call msg for en=" << this->evName_(aValidEv));
-    if (!this->msgSelf_->newMsgOK(
-        [self = this, aValidEv, weakHdlr = WeakMsgCB(aValidHdlr)]() noexcept {
-            cb_hdlr_(self, aValidEv, weakHdlr);  // not exe here
-        },
-        this->getPriority(aValidEv)
-    ))
-    {
-        ERR("(FreeHdlrDom) Failed to newMsgOK for en=" << this->evName_(aValidEv));
-    }
-}
-
 }  // namespace
 // ***********************************************************************************************
 // YYYY-MM-DD  Who       v)Modification Description
@@ -141,4 +102,7 @@ void FreeHdlrDomino<aDominoType>::triggerHdlr_(const SharedMsgCB& aValidHdlr, Do
 // 2022-12-04  CSZ       - simple & natural
 // 2025-02-13  CSZ       - support both SafePtr & shared_ptr
 // 2025-04-05  CSZ       3)tolerate exception
+// 2026-10-18  CSZ       - attr column in Domino (than own container & rmEv_)
+//                       - HdlrSlab handle than SharedMsgCB/WeakMsgCB
+//                       - callHdlr_() than own msg: so batch in HdlrDomino
 // ***********************************************************************************************
@@ -14,33 +14,65 @@
 //   * basic hdlr for common usage
 //     . and extendable
 //   . support rm hdlr
-//     . whenever succ, no cb, even cb already on road
+//     . whenever succ, no cb, even cb already on road (HdlrSlab handle invalid)
+//   . batch: all hdlrs of 1 wave & same pri in 1 msg (than 1 msg/hdlr: 10K fan-out = 10K msg & ping)
+//     . same order/pri/withdraw as 1 msg/hdlr: batch yields to higher pri msg & resumes before others
+//   . coalesce (opt-in per ev): flapping ev (eg link up/down F->T->F->T...) before MsgSelf drains
+//     . at most 1 on-road msg per hdlr (pending flag in HdlrSlab), so main thread work is bounded
+//     . optional skip the call if ev left the edge's state at dispatch (stale trigger)
+//   . edge (opt-in per ev): hdlr on F->T (default), T->F, or any change; than mirror "not-X" ev
+//   . worker hdlr: time-cost fn in THREAD_BACK, then auto set "done" ev in main thread
 //
-// - core: ev_hdlr_S_
+// - core: ev_hdlr_
 //
 // - class safe: yes
 //   . no duty to hdlr itself's any unsafe behavior
-//   . mem safe: yes SafePtr, no shared_ptr
+//   . mem safe: yes HdlrSlab handle, no shared_ptr
 // ***********************************************************************************************
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
+#include "HdlrSlab.hpp"
 #include "MsgSelf.hpp"
 #include "ObjAnywhere.hpp"
+#include "ThreadBack.hpp"
 #include "UniLog.hpp"
 #include "UniPtr.hpp"
 
 namespace rlib
 {
+enum ECoalesce : uint8_t
+{
+    ECoalesce_NONE,             // default: each F->T 1 hdlr call
+    ECoalesce_1_PENDING,        // at most 1 hdlr msg on road: more F->T before it is called are merged
+    ECoalesce_1_PENDING_SKIP_STALE, // & skip the call if ev left the edge's state at dispatch (eg F for RISE)
+
+    ECoalesce_MAX
+};
+enum EHdlrEdge : uint8_t
+{
+    EHdlrEdge_RISE,  // default: F->T
+    EHdlrEdge_FALL,  // T->F
+    EHdlrEdge_ANY,   // any change: hdlr checks state()
+
+    EHdlrEdge_MAX
+};
+
 // ***********************************************************************************************
 template<class aDominoType>
 class HdlrDomino : public aDominoType
 {
 public:
     explicit HdlrDomino(const LogName& aUniLogName = ULN_DEFAULT);
+    ~HdlrDomino() noexcept override;  // rm all hdlrs: invalidate on-road msgs
     [[nodiscard]] bool setMsgSelfOK(const S_PTR<MsgSelf>& aMsgSelf) noexcept;  // replace default; safe: yes SafePtr, no shared_ptr
 
     Domino::Event setHdlr(const Domino::EvName&, MsgCB aHdlr) noexcept;
@@ -56,25 +88,79 @@ public:
     Domino::Event setLinkedHdlr(const Domino::EvName& aNewEN, MsgCB aHdlr,
         const Domino::EvName& aTriggerEN) noexcept;
 
+    // -------------------------------------------------------------------------------------------
+    // - time-cost hdlr (than usr's newTaskOK + backFN + setState per task):
+    //   . when aEN triggers (as setHdlr): aDoneEN=F, mt_aWorkFN() runs in THREAD_BACK
+    //   . when done (main thread, by THREAD_BACK->hdlDoneFut()): aBackFN(ret) if any (eg replaceDataOK),
+    //     then aDoneEN=T if ret!=nullptr (ThreadBack: nullptr=failure)
+    //   . aDoneEN shall be chain head (setState); on-road result is dropped if worker/dom gone
+    //   . re-trigger while running: each run has own token, so only the latest run's result is used
+    //   . aBackFN shall not rm dom
+    //   . ret as aDoneEN's data: setWorkerHdlrToData() in DataDomino.hpp
+    // -------------------------------------------------------------------------------------------
+    Domino::Event setWorkerHdlr(const Domino::EvName& aEN, MT_TaskEntryFN mt_aWorkFN,
+        const Domino::EvName& aDoneEN, TaskBackFN aBackFN = nullptr) noexcept;
+
     [[nodiscard]] virtual EMsgPriority getPriority(Domino::Event) const noexcept { return EMsgPri_NORM; }
 
+    // - per ev, any time (on-road msg follows the latest policy at dispatch)
+    Domino::Event setCoalesce(const Domino::EvName&, const ECoalesce) noexcept;
+    [[nodiscard]] ECoalesce getCoalesce(Domino::Event aEv) const noexcept
+        { return ECoalesce(this->byteAttr_(coalesceCol_, aEv)); }
+
+    // - per ev (all its hdlrs), any time; new hdlr is called at once if ev is in the edge's state (any: always)
+    Domino::Event setEdge(const Domino::EvName&, const EHdlrEdge) noexcept;
+    [[nodiscard]] EHdlrEdge getEdge(Domino::Event) const noexcept;
+
 protected:
     void effect_(Domino::Event aEv) noexcept override;
-    virtual void triggerHdlr_(const SharedMsgCB& aValidHdlr, Domino::Event aValidEv) noexcept;
-    virtual bool rmOneHdlrOK_(Domino::Event aValidEv, const SharedMsgCB& aValidHdlr) noexcept;  // by aValidHdlr
+    void effectWaveEnd_() noexcept override;  // post batch(es)
+    virtual void triggerHdlr_(HdlrHandle aValidHdlr, Domino::Event aValidEv) noexcept;
+    virtual void callHdlr_(HdlrHandle aValidHdlr) noexcept;  // in msg; FreeHdlrDom rm-then-call
+    virtual bool rmOneHdlrOK_(Domino::Event aValidEv, HdlrHandle aValidHdlr) noexcept;  // by aValidHdlr
+    // - hot path (per ev/hdlr in wave): static call if composed by StaticDom, else virtual
+    void triggerHdlrFast_(HdlrHandle aValidHdlr, Domino::Event aValidEv) noexcept;
+    EMsgPriority getPriorityFast_(Domino::Event aEv) const noexcept;
 
     void rmEv_(Domino::Event aValidEv) noexcept override;
-    size_t nHdlr_(Domino::Event aEv) const noexcept { return (aEv < ev_hdlr_S_.size() && ev_hdlr_S_[aEv]) ? 1 : 0; }
+    size_t nHdlr_(Domino::Event aEv) const noexcept { return (aEv < ev_hdlr_.size() && ev_hdlr_[aEv]) ? 1 : 0; }
     bool rmOneHdlrOK_(Domino::Event aEv) noexcept;
 
-    static void cb_hdlr_(HdlrDomino*, Domino::Event, const WeakMsgCB&) noexcept;
+    static void cb_hdlr_(HdlrDomino*, HdlrHandle) noexcept;
+    static void cb_workerDone_(HdlrDomino*, HdlrHandle aToken, SafePtr<void>) noexcept;
+    void startWorker_(Domino::Event aValidEv) noexcept;
+    void workerDone_(HdlrHandle aValidToken, SafePtr<void>) noexcept;
+    void rmWorker_(Domino::Event aEv) noexcept;
+    // - hdlrs of 1 batch msg; dropped w/o run (eg post/resume failed) -> clear their pending, else a
+    //   coalesced hdlr never posts again
+    struct Batch
+    {
+        std::vector<HdlrHandle> hdlrs_;
+        size_t next_ = 0;  // 1st not run yet
+
+        explicit Batch(std::vector<HdlrHandle>&& aHdlrs) noexcept : hdlrs_(std::move(aHdlrs)) {}
+        Batch(Batch&&) noexcept = default;  // moved-from vector is empty: no-op at dtor
+        ~Batch() noexcept;
+    };
+    static void cb_batch_(HdlrDomino*, MsgSelf*, EMsgPriority, Batch&) noexcept;
 
     // -------------------------------------------------------------------------------------------
 private:
     // vector is faster & less mem than unordered_map when eg:
     // - nEv is not big
     // - nEv/nHdlr >> 10
-    std::vector<SharedMsgCB> ev_hdlr_S_;  // [event]=hdlr; null=no hdlr
+    std::vector<HdlrHandle> ev_hdlr_;  // [event]=hdlr in HdlrSlab; 0=no hdlr
+    std::array<std::vector<HdlrHandle>, EMsgPri_MAX> batch_;  // [pri]=hdlrs triggered in current wave
+    const Domino::AttrCol coalesceCol_ = this->newByteAttr_();  // [event]=ECoalesce; auto NONE when rm ev
+
+    struct Worker
+    {
+        std::shared_ptr<const MT_TaskEntryFN> mt_workFN_;  // shared w/ on-road run: no cp of usr's capture
+        std::shared_ptr<const TaskBackFN>     backFN_;     // null=none
+        Domino::EvName doneEN_;  // than Event: still ok if done ev rm-ed
+        HdlrHandle     token_;   // of latest run in HdlrSlab (no cb, tag=worker ev): valid=its result wanted
+    };
+    std::unordered_map<Domino::Event, Worker> ev_worker_;  // sparse: few ev is worker
 protected:
     S_PTR<MsgSelf> msgSelf_ = ObjAnywhere::getObj<MsgSelf>();
 public:
@@ -90,18 +176,86 @@ HdlrDomino<aDominoType>::HdlrDomino(const LogName& aUniLogName) : aDominoType(aU
 }
 
 // ***********************************************************************************************
-// - static fn
-// - member fn: for catch(...) to ERR()
 template<class aDominoType>
-void HdlrDomino<aDominoType>::cb_hdlr_(HdlrDomino* aSelfDom, Domino::Event aValidEv, const WeakMsgCB& aWeakCB) noexcept
+HdlrDomino<aDominoType>::~HdlrDomino() noexcept
 {
-    if (auto cb = aWeakCB.lock()) {  // hdlr ok -> Dom.map ok -> Dom ok
-        try { (*(cb.get()))(); }  // setHdlr() forbid cb==null
-        catch(...) {
-            auto& oneLog = *aSelfDom;
-            ERR("(HdlrDom) hdlr() except=" << mt_exceptInfo() << ", en=" << aSelfDom->evName_(aValidEv));
+    for (auto&& hdlr : ev_hdlr_)
+        if (hdlr)
+            HdlrSlab::mt_inst().rmHdlrOK(hdlr);
+    for (auto&& [ev, worker] : ev_worker_)
+        HdlrSlab::mt_inst().rmHdlrOK(worker.token_);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::callHdlr_(HdlrHandle aValidHdlr) noexcept
+{
+    auto&& slab = HdlrSlab::mt_inst();
+    auto cb = slab.take(aValidHdlr);
+    if (! cb)
+        return;  // eg re-entry handleAllMsg() in cb
+    const Domino::Event validEv = slab.tag(aValidHdlr);
+    try { cb(); }
+    catch(...) { ERR("(HdlrDom) hdlr() except=" << mt_exceptInfo() << ", en=" << this->evName_(validEv)); }
+    slab.putBack(aValidHdlr, std::move(cb));  // no-op if hdlr rm-ed (even dom gone) in cb
+}
+
+// ***********************************************************************************************
+// - static fn: aSelfDom is valid only after its hdlr is valid
+// - raw aMsgSelf: valid since it's running this msg; S_PTR in msg = MsgSelf owns itself (leak)
+template<class aDominoType>
+void HdlrDomino<aDominoType>::cb_batch_(HdlrDomino* aSelfDom, MsgSelf* aMsgSelf, EMsgPriority aPri,
+    Batch& aBatch) noexcept
+{
+    while (aBatch.next_ < aBatch.hdlrs_.size())
+    {
+        cb_hdlr_(aSelfDom, aBatch.hdlrs_[aBatch.next_++]);
+        if (aBatch.next_ == aBatch.hdlrs_.size() || ! aMsgSelf->shallYield(aPri))
+            continue;
+
+        // as if rest hdlrs were separate msgs
+        const auto nRest = aBatch.hdlrs_.size() - aBatch.next_;
+        if (!aMsgSelf->resumeMsgOK(
+            [aSelfDom, aMsgSelf, aPri, batch = std::move(aBatch)]() mutable noexcept {
+                cb_batch_(aSelfDom, aMsgSelf, aPri, batch);
+            },
+            aPri
+        ))
+        {
+            auto& oneLog = *aMsgSelf;
+            ERR("(HdlrDom) Failed to resume batch, nDropHdlr=" << nRest);  // ~Batch cleared their pending
         }
+        return;
+    }
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+HdlrDomino<aDominoType>::Batch::~Batch() noexcept
+{
+    auto&& slab = HdlrSlab::mt_inst();
+    for (auto i = next_; i < hdlrs_.size(); ++i)
+        if (slab.isValid(hdlrs_[i]))
+            slab.setPending(hdlrs_[i], false);
+}
+
+// ***********************************************************************************************
+// - static fn: aSelfDom is valid only after aHdlr is valid
+template<class aDominoType>
+void HdlrDomino<aDominoType>::cb_hdlr_(HdlrDomino* aSelfDom, HdlrHandle aHdlr) noexcept
+{
+    auto&& slab = HdlrSlab::mt_inst();
+    if (! slab.isValid(aHdlr))
+        return;
+    // hdlr ok -> Dom ok
+    if (slab.isPending(aHdlr))
+    {
+        slab.setPending(aHdlr, false);  // before call: new F->T can post again
+        const Domino::Event validEv = slab.tag(aHdlr);
+        if (aSelfDom->getCoalesce(validEv) == ECoalesce_1_PENDING_SKIP_STALE && ! aSelfDom->isEffectEdge_(validEv))
+            return;  // stale
     }
+    aSelfDom->callHdlr_(aHdlr);
 }
 
 // ***********************************************************************************************
@@ -115,7 +269,82 @@ void HdlrDomino<aDominoType>::effect_(Domino::Event aEv) noexcept
         return;
 
     HID("(HdlrDom) Succeed to trigger 1 hdlr of EvName=" << this->evName_(aEv));
-    triggerHdlr_(ev_hdlr_S_[aEv], aEv);
+    triggerHdlrFast_(ev_hdlr_[aEv], aEv);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::effectWaveEnd_() noexcept
+{
+    aDominoType::effectWaveEnd_();
+
+    for (size_t pri = EMsgPri_MIN; pri < EMsgPri_MAX; ++pri)
+    {
+        auto&& hdlrs = batch_[pri];
+        if (hdlrs.empty())
+            continue;
+        HID("(HdlrDom) post batch of nHdlr=" << hdlrs.size() << ", pri=" << pri);
+
+        if (hdlrs.size() == 1)
+        {
+            if (! msgSelf_->newMsgOK([aSelfDom = this, hdlr = hdlrs[0]]() noexcept { cb_hdlr_(aSelfDom, hdlr); },
+                EMsgPriority(pri)))  // no heap
+            {
+                ERR("(HdlrDom) Failed to newMsgOK for batch of pri=" << pri);
+                auto&& slab = HdlrSlab::mt_inst();
+                if (slab.isValid(hdlrs[0]))  // as ~Batch: may be rm-ed in wave
+                    slab.setPending(hdlrs[0], false);  // else coalesced hdlr never posts again
+            }
+        }
+        else if (! msgSelf_->newMsgOK([aSelfDom = this, msgSelf = &*(msgSelf_.get()), pri = EMsgPriority(pri),
+            batch = Batch(std::move(hdlrs))]() mutable noexcept { cb_batch_(aSelfDom, msgSelf, pri, batch); },
+            EMsgPriority(pri)))
+        {
+            ERR("(HdlrDom) Failed to newMsgOK for batch of pri=" << pri);  // ~Batch cleared their pending
+        }
+        hdlrs.clear();  // moved-from or copied
+    }
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+Domino::Event HdlrDomino<aDominoType>::setCoalesce(const Domino::EvName& aEvName, const ECoalesce aCoalesce) noexcept
+{
+    if (aCoalesce >= ECoalesce_MAX)
+    {
+        WRN("(HdlrDom) Failed!!! invalid coalesce=" << size_t(aCoalesce) << " for en=" << aEvName);
+        return Domino::D_EVENT_FAILED_RET;
+    }
+
+    HID("(HdlrDom) EvName=" << aEvName << ", coalesce=" << size_t(aCoalesce));
+    auto&& event = this->newEvent(aEvName);
+    this->setByteAttr_(coalesceCol_, event, aCoalesce);
+    return event;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+Domino::Event HdlrDomino<aDominoType>::setEdge(const Domino::EvName& aEvName, const EHdlrEdge aEdge) noexcept
+{
+    if (aEdge >= EHdlrEdge_MAX)
+    {
+        WRN("(HdlrDom) Failed!!! invalid edge=" << size_t(aEdge) << " for en=" << aEvName);
+        return Domino::D_EVENT_FAILED_RET;
+    }
+
+    HID("(HdlrDom) EvName=" << aEvName << ", edge=" << size_t(aEdge));
+    auto&& event = this->newEvent(aEvName);
+    this->setEffectEdge_(event, aEdge != EHdlrEdge_FALL, aEdge != EHdlrEdge_RISE);
+    return event;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+EHdlrEdge HdlrDomino<aDominoType>::getEdge(Domino::Event aEv) const noexcept
+{
+    if (! this->effectOnFall_(aEv))
+        return EHdlrEdge_RISE;
+    return this->effectOnRise_(aEv) ? EHdlrEdge_ANY : EHdlrEdge_FALL;
 }
 
 // ***********************************************************************************************
@@ -154,7 +383,8 @@ template<class aDominoType>
 bool HdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aEv) noexcept
 {
     if (nHdlr_(aEv) > 0) {
-        ev_hdlr_S_[aEv] = nullptr;
+        HdlrSlab::mt_inst().rmHdlrOK(ev_hdlr_[aEv]);
+        ev_hdlr_[aEv] = 0;
         return true;
     }
     return false;
@@ -164,11 +394,22 @@ bool HdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aEv) noexcept
 template<typename aDominoType>
 void HdlrDomino<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
 {
-    if (nHdlr_(aValidEv) > 0)
-        ev_hdlr_S_[aValidEv] = nullptr;
+    rmOneHdlrOK_(aValidEv);
+    rmWorker_(aValidEv);
     aDominoType::rmEv_(aValidEv);
 }
 
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::rmWorker_(Domino::Event aEv) noexcept
+{
+    auto&& ev_worker = ev_worker_.find(aEv);
+    if (ev_worker == ev_worker_.end())
+        return;
+    HdlrSlab::mt_inst().rmHdlrOK(ev_worker->second.token_);  // drop on-road result
+    ev_worker_.erase(ev_worker);
+}
+
 // ***********************************************************************************************
 template<class aDominoType>
 bool HdlrDomino<aDominoType>::rmOneHdlrOK(const Domino::EvName& aEvName) noexcept
@@ -179,19 +420,17 @@ bool HdlrDomino<aDominoType>::rmOneHdlrOK(const Domino::EvName& aEvName) noexcep
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool HdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aValidEv, const SharedMsgCB& aValidHdlr) noexcept
+bool HdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aValidEv, HdlrHandle aValidHdlr) noexcept
 {
     if (nHdlr_(aValidEv) == 0)
         return false;
 
     // req: must match
-    if (ev_hdlr_S_[aValidEv] != aValidHdlr)
+    if (ev_hdlr_[aValidEv] != aValidHdlr)
         return false;
 
-    HID("(HdlrDom) Will remove hdlr of EvName=" << this->evName_(aValidEv)
-        << ", nHdlrRef=" << ev_hdlr_S_[aValidEv].use_count());
-    ev_hdlr_S_[aValidEv] = nullptr;
-    return true;
+    HID("(HdlrDom) Will remove hdlr of EvName=" << this->evName_(aValidEv));
+    return rmOneHdlrOK_(aValidEv);
 }
 
 // ***********************************************************************************************
@@ -212,14 +451,14 @@ Domino::Event HdlrDomino<aDominoType>::setHdlr(const Domino::EvName& aEvName, Ms
     }
 
     // set
-    auto newHdlr = MAKE_PTR<MsgCB>(std::move(aHdlr));
-    if (newEv >= ev_hdlr_S_.size())
-        ev_hdlr_S_.resize(newEv + 1);
-    ev_hdlr_S_[newEv] = newHdlr;
+    const auto newHdlr = HdlrSlab::mt_inst().newHdlr(std::move(aHdlr), newEv);
+    if (newEv >= ev_hdlr_.size())
+        ev_hdlr_.resize(newEv + 1);
+    ev_hdlr_[newEv] = newHdlr;
     HID("(HdlrDom) Succeed for EvName=" << aEvName);
 
     // call
-    if (this->state(newEv) == true)
+    if (this->isEffectEdge_(newEv))
     {
         HID("(HdlrDom) Trigger the new hdlr of EvName=" << aEvName);
         triggerHdlr_(newHdlr, newEv);
@@ -227,6 +466,96 @@ Domino::Event HdlrDomino<aDominoType>::setHdlr(const Domino::EvName& aEvName, Ms
     return newEv;
 }
 
+// ***********************************************************************************************
+template<class aDominoType>
+Domino::Event HdlrDomino<aDominoType>::setWorkerHdlr(const Domino::EvName& aEN, MT_TaskEntryFN mt_aWorkFN,
+    const Domino::EvName& aDoneEN, TaskBackFN aBackFN) noexcept
+{
+    // validate
+    if (! mt_aWorkFN)
+    {
+        WRN("(HdlrDom) Failed!!! not accept mt_aWorkFN=nullptr.");
+        return Domino::D_EVENT_FAILED_RET;
+    }
+
+    // set: hdlr (16B, no heap) is called via msg, so worker below is ready before
+    const auto ev = this->newEvent(aEN);
+    if (setHdlr(aEN, [aSelfDom = this, ev]{ aSelfDom->startWorker_(ev); }) == Domino::D_EVENT_FAILED_RET)
+        return Domino::D_EVENT_FAILED_RET;
+
+    this->newEvent(aDoneEN);
+    rmWorker_(ev);  // eg prev worker's hdlr was auto-rm by FreeHdlrDom
+    ev_worker_.emplace(ev, Worker{  // except eg bad_alloc: can't recover->terminate
+        std::make_shared<const MT_TaskEntryFN>(std::move(mt_aWorkFN)),
+        aBackFN ? std::make_shared<const TaskBackFN>(std::move(aBackFN)) : nullptr,
+        aDoneEN,
+        HdlrSlab::mt_inst().newHdlr(MsgCB(), ev)});
+    HID("(HdlrDom) Succeed for EvName=" << aEN << ", doneEN=" << aDoneEN);
+    return ev;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::startWorker_(Domino::Event aValidEv) noexcept
+{
+    auto&& ev_worker = ev_worker_.find(aValidEv);
+    if (ev_worker == ev_worker_.end())
+        return;  // impossible
+    auto&& worker = ev_worker->second;
+
+    auto&& threadBack = THREAD_BACK;
+    if (! threadBack)
+    {
+        ERR("(HdlrDom) Failed!!! no THREAD_BACK for worker en=" << this->evName_(aValidEv));
+        return;
+    }
+    this->setState({{worker.doneEN_, false}});  // n-go: done reflects the latest run
+
+    // new token per run: on-road (stale) run's result is dropped, not set done while latest runs
+    auto&& slab = HdlrSlab::mt_inst();
+    slab.rmHdlrOK(worker.token_);
+    worker.token_ = slab.newHdlr(MsgCB(), aValidEv);
+    if (! threadBack->newTaskOK(
+        [mt_workFN = worker.mt_workFN_]{ return (*mt_workFN)(); },  // 1 small alloc, than cp usr's capture
+        [aSelfDom = this, token = worker.token_](SafePtr<void> aRet) noexcept {  // 16B: no heap
+            cb_workerDone_(aSelfDom, token, std::move(aRet));
+        },
+        *this
+    ))
+    {
+        ERR("(HdlrDom) Failed to newTaskOK for worker en=" << this->evName_(aValidEv));
+    }
+}
+
+// ***********************************************************************************************
+// - static fn: aSelfDom is valid only after aToken is valid
+template<class aDominoType>
+void HdlrDomino<aDominoType>::cb_workerDone_(HdlrDomino* aSelfDom, HdlrHandle aToken, SafePtr<void> aRet) noexcept
+{
+    if (HdlrSlab::mt_inst().isValid(aToken))  // worker ok -> Dom ok
+        aSelfDom->workerDone_(aToken, std::move(aRet));
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::workerDone_(HdlrHandle aValidToken, SafePtr<void> aRet) noexcept
+{
+    const Domino::Event workerEv = HdlrSlab::mt_inst().tag(aValidToken);
+    auto&& worker = ev_worker_.find(workerEv)->second;  // valid token -> worker exist
+    const auto doneEN = worker.doneEN_;  // cp: backFN may rm/replace worker
+    const bool succ = static_cast<bool>(aRet);
+    if (auto backFN = worker.backFN_)  // ref-cnt: alive even if backFN rm/replace worker
+    {
+        try { (*backFN)(std::move(aRet)); }
+        catch(...) { ERR("(HdlrDom) backFN() except=" << mt_exceptInfo() << ", en=" << this->evName_(workerEv)); }
+    }
+
+    if (succ)
+        this->setState({{doneEN, true}});
+    else
+        WRN("(HdlrDom) worker failed (ret=nullptr), en=" << this->evName_(workerEv) << ", so keep doneEN=F");
+}
+
 // ***********************************************************************************************
 template<class aDominoType>
 bool HdlrDomino<aDominoType>::setMsgSelfOK(const S_PTR<MsgSelf>& aMsgSelf) noexcept
@@ -252,17 +581,58 @@ bool HdlrDomino<aDominoType>::setMsgSelfOK(const S_PTR<MsgSelf>& aMsgSelf) noexc
 
 // ***********************************************************************************************
 template<class aDominoType>
-void HdlrDomino<aDominoType>::triggerHdlr_(const SharedMsgCB& aValidHdlr, Domino::Event aValidEv) noexcept
+EMsgPriority HdlrDomino<aDominoType>::getPriorityFast_(Domino::Event aEv) const noexcept
 {
+    using Final = typename aDominoType::FinalType;
+    if constexpr (std::is_void_v<Final>)
+        return getPriority(aEv);
+    else
+        return Final::st_getPriority_(*this, aEv);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::triggerHdlrFast_(HdlrHandle aValidHdlr, Domino::Event aValidEv) noexcept
+{
+    using Final = typename aDominoType::FinalType;
+    if constexpr (std::is_void_v<Final>)
+        triggerHdlr_(aValidHdlr, aValidEv);
+    else
+        Final::st_triggerHdlr_(*this, aValidHdlr, aValidEv);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void HdlrDomino<aDominoType>::triggerHdlr_(HdlrHandle aValidHdlr, Domino::Event aValidEv) noexcept
+{
+    if (getCoalesce(aValidEv) != ECoalesce_NONE)
+    {
+        auto&& slab = HdlrSlab::mt_inst();
+        if (slab.isPending(aValidHdlr))
+        {
+            HID("(HdlrDom) coalesced since hdlr already on road, en=" << this->evName_(aValidEv));
+            return;
+        }
+        slab.setPending(aValidHdlr, true);
+    }
+
+    const auto pri = getPriorityFast_(aValidEv);
+    if (this->isInWave_() && MsgSelf::isValidPri(pri))
+    {
+        batch_[pri].push_back(aValidHdlr);  // post in effectWaveEnd_()
+        return;
+    }
+
     HID("(HdlrDom) trigger a new msg.");
     if (!msgSelf_->newMsgOK(
-        [aSelfDom = this, aValidEv, weakMsgCB = WeakMsgCB(aValidHdlr)]() noexcept {
-            cb_hdlr_(aSelfDom, aValidEv, weakMsgCB);  // not exe here
+        [aSelfDom = this, aValidHdlr]() noexcept {  // 16B: in std::function's buffer, no heap
+            cb_hdlr_(aSelfDom, aValidHdlr);  // not exe here
         },
-        getPriority(aValidEv)
+        pri
     ))
     {
         ERR("(HdlrDom) Failed to newMsgOK for en=" << this->evName_(aValidEv));
+        HdlrSlab::mt_inst().setPending(aValidHdlr, false);  // else coalesced hdlr never posts again
     }
 }
 
@@ -282,4 +652,14 @@ void HdlrDomino<aDominoType>::triggerHdlr_(const SharedMsgCB& aValidHdlr, Domino
 // 2024-03-10  CSZ       - enhance safe eg setMsgSelf()
 // 2025-02-13  CSZ       - support both SafePtr & shared_ptr
 // 2025-04-05  CSZ       3)tolerate exception
+// 2026-10-18  CSZ       4)HdlrSlab handle than SharedMsgCB/WeakMsgCB
+//                       - batch hdlrs per wave per pri
+//                       - coalesce flapping ev
+//                       - falling-edge & any-change hdlr
+//                       - worker hdlr via THREAD_BACK
+// 2026-10-19  CSZ       - static call of hot hooks for StaticDom
+//                       - worker: token per run, shared fn than cp per run/done
 // ***********************************************************************************************
+// - why worker's fn in shared_ptr (than SafePtr/cp)?
+//   . cp per run = heap + cp of usr's capture if not small trivially-copyable (std::function limit)
+//   . shared: 1 small alloc per run whatever usr captures; ref-cnt is mt-safe (dtor may be in THREAD_BACK)
@@ -0,0 +1,66 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include "HdlrSlab.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+HdlrHandle HdlrSlab::newHdlr(MsgCB&& aHdlr, uint64_t aTag) noexcept
+{
+    uint32_t idx = freeHead_;
+    if (idx == UINT32_MAX)
+    {
+        idx = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();  // except eg bad_alloc: can't recover->terminate
+    }
+    else
+        freeHead_ = slots_[idx].aux_;
+
+    auto&& slot = slots_[idx];
+    slot.cb_  = move(aHdlr);
+    slot.tag_ = aTag;
+    slot.aux_ = 0;  // not pending, pos 0
+    ++nHdlr_;
+    return (HdlrHandle(slot.gen_) << 32) | idx;
+}
+
+// ***********************************************************************************************
+void HdlrSlab::putBack(HdlrHandle aHdlr, MsgCB&& aCB) noexcept
+{
+    if (isValid(aHdlr))
+        slots_[idx_(aHdlr)].cb_ = move(aCB);
+}
+
+// ***********************************************************************************************
+bool HdlrSlab::rmHdlrOK(HdlrHandle aHdlr) noexcept
+{
+    if (! isValid(aHdlr))
+        return false;
+
+    auto&& slot = slots_[idx_(aHdlr)];
+    MsgCB rmCB;  // release captured resrc at return (like rm shared_ptr): its destructor may re-enter slab
+    rmCB.swap(slot.cb_);
+    if (++slot.gen_ == 0)
+        slot.gen_ = 1;  // 0 is null handle
+    slot.aux_ = freeHead_;
+    freeHead_ = idx_(aHdlr);
+    --nHdlr_;
+    return true;
+}
+
+// ***********************************************************************************************
+MsgCB HdlrSlab::take(HdlrHandle aHdlr) noexcept
+{
+    MsgCB cb;
+    if (isValid(aHdlr))
+        cb.swap(slots_[idx_(aHdlr)].cb_);  // swap than move: slot surely empty after
+    return cb;
+}
+
+}  // namespace
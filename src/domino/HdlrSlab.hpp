@@ -0,0 +1,99 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: dense store of all dom hdlrs (MsgCB), addressed by 8B handle = slot idx + generation
+// - why:
+//   . HdlrDomino was MAKE_PTR<MsgCB> per hdlr (heap ctrl block) + WeakMsgCB per trigger + lock() per call
+//     = 2 atomic ref-cnt ops & a heap msg (lambda w/ weak_ptr > std::function's inline buffer)
+//   . while all run in main thread
+// - how:
+//   . slot = MsgCB (std::function's small-buffer: small lambda w/o heap) + gen + tag (owner's info eg Event)
+//   . rm hdlr = gen+1 & slot to free list: any old handle (eg in on-road msg) becomes invalid, O(1)
+//   . on-road msg captures {dom*, handle} = 16B: fits std::function inline buffer, no heap per trigger
+//     . handle valid -> hdlr not rm-ed -> its dom alive (dom rm all its hdlrs in destructor)
+//   . take()/putBack() around calling: hdlr may rm itself / add hdlr (slots_ realloc) during call
+//
+// - core: slots_
+// - MT safe: no, so 1 slab per thread (mt_inst()); hdlr shall be set/called/rm-ed in same thread (as MsgSelf)
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MsgSelf.hpp"
+
+namespace rlib
+{
+using HdlrHandle = uint64_t;  // [gen:32][idx:32]; 0=null (gen starts from 1)
+
+// ***********************************************************************************************
+class HdlrSlab
+{
+public:
+    static HdlrSlab& mt_inst() noexcept { thread_local HdlrSlab inst; return inst; }
+
+    [[nodiscard]] HdlrHandle newHdlr(MsgCB&& aHdlr, uint64_t aTag) noexcept;
+    bool rmHdlrOK(HdlrHandle) noexcept;  // false if already rm-ed
+
+    [[nodiscard]] bool     isValid(HdlrHandle aHdlr) const noexcept
+        { return idx_(aHdlr) < slots_.size() && slots_[idx_(aHdlr)].gen_ == gen_(aHdlr); }
+    [[nodiscard]] uint64_t tag(HdlrHandle aValidHdlr) const noexcept { return slots_[idx_(aValidHdlr)].tag_; }
+    [[nodiscard]] size_t   nHdlr() const noexcept { return nHdlr_; }
+
+    // - owner's 1 bit per hdlr, eg HdlrDomino's coalesce: "1 msg of this hdlr on road"; auto clear by newHdlr()
+    [[nodiscard]] bool isPending(HdlrHandle aValidHdlr) const noexcept
+        { return slots_[idx_(aValidHdlr)].aux_ & PENDING; }
+    void setPending(HdlrHandle aValidHdlr, bool aPending) noexcept
+    {
+        auto&& aux = slots_[idx_(aValidHdlr)].aux_;
+        aux = aPending ? (aux | PENDING) : (aux & ~PENDING);
+    }
+    // - owner's 31 bit per hdlr, eg MultiHdlrDomino's idx in ev's hdlrs (O(1) rm); auto clear by newHdlr()
+    [[nodiscard]] uint32_t pos(HdlrHandle aValidHdlr) const noexcept
+        { return slots_[idx_(aValidHdlr)].aux_ & ~PENDING; }
+    void setPos(HdlrHandle aValidHdlr, uint32_t aPos) noexcept
+    {
+        auto&& aux = slots_[idx_(aValidHdlr)].aux_;
+        aux = (aux & PENDING) | (aPos & ~PENDING);
+    }
+
+    // - take cb out to call (empty if invalid or already taken), then putBack (no-op if rm-ed in call)
+    [[nodiscard]] MsgCB take(HdlrHandle) noexcept;
+    void putBack(HdlrHandle, MsgCB&&) noexcept;
+
+private:
+    static uint32_t idx_(HdlrHandle aHdlr) noexcept { return static_cast<uint32_t>(aHdlr); }
+    static uint32_t gen_(HdlrHandle aHdlr) noexcept { return static_cast<uint32_t>(aHdlr >> 32); }
+
+    // -------------------------------------------------------------------------------------------
+    struct Slot
+    {
+        MsgCB    cb_;
+        uint64_t tag_     = 0;
+        uint32_t gen_     = 1;
+        uint32_t aux_     = 0;  // in free list: next free idx; in use: pending flag + pos (no extra mem)
+    };
+    static constexpr uint32_t PENDING = 0x8000'0000;  // aux_'s top bit
+    std::vector<Slot> slots_;
+    uint32_t          freeHead_ = UINT32_MAX;  // free list via Slot.aux_
+    size_t            nHdlr_ = 0;
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+//                       - pending flag
+// 2026-10-19  CSZ       - owner's pos
+// ***********************************************************************************************
+// - why not per-dom slab?
+//   . on-road msg must know dom alive before touch dom's slab; a global slab knows it by handle only
+// - why thread_local than process-wide?
+//   . no lock; doms (& their MsgSelf) of diff threads never share a hdlr
+// - why gen 32bit?
+//   . a slot reused 4G times while an old handle still on road is impossible in practice
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+
+#include "MtChangeFeed.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+static size_t roundUpPow2(size_t aN) noexcept
+{
+    size_t n = 1;
+    while (n < aN)
+        n <<= 1;
+    return n;
+}
+
+// ***********************************************************************************************
+MtChangeFeed::MtChangeFeed(size_t aMinCapacity)
+    : mask_(roundUpPow2(aMinCapacity) - 1)
+    , ring_(make_unique<DomChange[]>(mask_ + 1))  // except eg bad_alloc: break constructor
+{}
+
+// ***********************************************************************************************
+bool MtChangeFeed::attachOK(const void* aDom, size_t aNEv) noexcept
+{
+    if (aDom == nullptr || (dom_ && dom_ != aDom))
+        return false;
+
+    dom_ = aDom;
+    if (ev_nRun_.size() < aNEv)
+        ev_nRun_.resize(aNEv);  // except eg bad_alloc: can't recover->terminate
+    return true;
+}
+
+// ***********************************************************************************************
+void MtChangeFeed::detach(const void* aDom) noexcept
+{
+    if (dom_ != aDom)
+        return;
+    dom_ = nullptr;
+    ev_nRun_.clear();
+}
+
+// ***********************************************************************************************
+void MtChangeFeed::newEv(size_t aEv) noexcept
+{
+    if (aEv >= ev_nRun_.size())
+        ev_nRun_.resize(aEv + 1);  // except eg bad_alloc: can't recover->terminate
+}
+
+// ***********************************************************************************************
+size_t MtChangeFeed::mt_pop(DomChange* aOut, size_t aMaxN) noexcept
+{
+    if (aOut == nullptr)
+        return 0;
+
+    const auto tail = mt_tail_.load(memory_order_relaxed);  // only consumer writes it
+    const auto n = min(aMaxN, mt_head_.load(memory_order_acquire) - tail);  // see producer's records
+    for (size_t i = 0; i < n; ++i)
+        aOut[i] = ring_[(tail + i) & mask_];
+    mt_tail_.store(tail + n, memory_order_release);  // free slots to producer after copied
+    return n;
+}
+
+}  // namespace
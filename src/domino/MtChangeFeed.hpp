@@ -0,0 +1,130 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - ISSUE:
+//   . external observers (metrics exporter, UI, recorder thread) want each tile transition
+//   . but can only parse TRC log: formatting on hot path, text parsing, main thread involved
+//
+// - how:
+//   . Domino::pureSetStateOK_() pushes a fixed-size binary DomChange into ring_ (opt-in)
+//   . another thread mt_pop() w/o lock, w/o formatting, w/o main thread
+//
+// - core: ring_
+//
+// - overflow policy: DROP_NEW
+//   . REQ: never block/slow main thread for a slow consumer
+//   . so full ring drops the newest record & counts it in mt_nDrop()
+//   . consumer can detect a gap by mt_nDrop() delta
+//
+// - MT safe: yes as SPSC
+//   . 1 producer = main thread; 1 feed per Domino (DomChange has no dom id: attachOK() rejects a 2nd)
+//   . 1 consumer = any 1 thread (mt_ prefix)
+// - mem safe: yes
+// ***********************************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct DomChange
+{
+    size_t   ev;     // Domino::Event
+    uint64_t tsNs;   // monotonic (steady_clock) ns
+    uint32_t nRun;   // n-go run# of ev: inc on each F->T; so T & its later F share the same nRun
+    bool     state;  // new state
+};
+
+// ***********************************************************************************************
+class MtChangeFeed
+{
+public:
+    // @param aMinCapacity: round up to 2^n (fast index by mask); 0 -> 1
+    explicit MtChangeFeed(size_t aMinCapacity = DEFAULT_CAPACITY) noexcept(false);
+
+    MtChangeFeed(const MtChangeFeed&)            = delete;
+    MtChangeFeed& operator=(const MtChangeFeed&) = delete;
+
+    // - main thread ONLY (called by Domino)
+    // - attach: false if attached by another dom; size nRun for aNEv existing ev(s)
+    // - detach: nRun restart from 0 for next dom
+    [[nodiscard]] bool attachOK(const void* aDom, size_t aNEv) noexcept;
+    void detach(const void* aDom) noexcept;
+    void newEv(size_t aEv) noexcept;  // size nRun here than in push() - no alloc on hot path
+    void rmEv(size_t aEv) noexcept { if (aEv < ev_nRun_.size()) ev_nRun_[aEv] = 0; }  // recycled ev restart nRun
+
+    // - main thread ONLY (called by Domino)
+    // - full: drop newest, never block
+    // - ev not sized by attachOK()/newEv(): nRun=0 (never alloc)
+    void push(size_t aEv, bool aNewState) noexcept;
+
+    // - consumer thread ONLY (any 1 thread)
+    // @ret: nRecord popped into aOut[0..ret)
+    [[nodiscard]] size_t mt_pop(DomChange* aOut, size_t aMaxN) noexcept;
+    [[nodiscard]] bool mt_pop(DomChange& aOut) noexcept { return mt_pop(&aOut, 1) == 1; }
+    [[nodiscard]] size_t mt_nDrop() const noexcept { return mt_nDrop_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+private:
+    const size_t mask_;
+    std::unique_ptr<DomChange[]> ring_;
+    std::vector<uint32_t> ev_nRun_;  // [event]=nRun; main thread only
+    const void* dom_ = nullptr;      // attached dom; main thread only
+
+    // separate cache line: avoid false sharing between producer & consumer
+    alignas(64) std::atomic<size_t> mt_head_ = 0;  // next to write; written by producer only
+    size_t cachedTail_ = 0;                         // producer's view of mt_tail_: min atomic load
+    alignas(64) std::atomic<size_t> mt_tail_ = 0;  // next to read; written by consumer only
+    alignas(64) std::atomic<size_t> mt_nDrop_ = 0;
+
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;  // 1.5MB; ~10ms burst at 6M rec/s
+};
+
+// ***********************************************************************************************
+// inline: hot path of Domino::pureSetStateOK_()
+inline void MtChangeFeed::push(size_t aEv, bool aNewState) noexcept
+{
+    const auto nRun = aEv >= ev_nRun_.size() ? 0
+        : aNewState ? ++ev_nRun_[aEv] : ev_nRun_[aEv];
+
+    const auto head = mt_head_.load(std::memory_order_relaxed);
+    if (head - cachedTail_ > mask_)  // full per cache, refresh
+    {
+        cachedTail_ = mt_tail_.load(std::memory_order_acquire);
+        if (head - cachedTail_ > mask_)
+        {
+            mt_nDrop_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    ring_[head & mask_] = DomChange{aEv,
+        uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count()),
+        nRun, aNewState};
+    mt_head_.store(head + 1, std::memory_order_release);  // publish record to consumer
+}
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// 2026-10-19  CSZ       - 1 feed per dom; nRun sized by newEv() & reset by rmEv()
+// ***********************************************************************************************
+// - why not overwrite-oldest?
+//   . producer would move consumer's mt_tail_ while consumer copying the same slot
+//   . need seqlock per slot - more cost on hot path for a rare case
+// - why shared_ptr (not SafePtr) to Domino::setChangeFeedOK()?
+//   . feed is shared cross thread, while SafePtr is single-thread-use
+// - why 1 feed per dom?
+//   . DomChange.ev is per dom: consumer can't tell which dom if 2 doms share 1 feed
+//   . dom id in each record costs ring mem & hot path for a rare case; 1 feed per dom is enough
@@ -13,17 +13,24 @@
 //   . extend multi-hdlr if needed
 //   . legacy Domino uses multi-event to support multi-hdlr, but these events' state not auto-sync always
 //
-// - core:
+// - core: ev_hdlrs_
+//   . [event] = hdlrs (dense like HdlrDomino's ev_hdlr_): most ev has 1~4 hdlrs
+//   . each = interned HdlrName id + add order + HdlrSlab handle = 16B, no node/string per hdlr
+//   . rm by handle O(1): idx in ev_hdlrs_[event] kept in HdlrSlab::pos(), swap-rm with the last
+//   . call in add order: ev is re-sorted by add order (lazy) before its next effect_() after any rm
+//   . interned HdlrName is ref-cnt: rm-ed with its last hdlr (churny/generated names not leak)
 //
 // - class safe: yes
 // ***********************************************************************************************
 #pragma once
 
-#include <map>
-#include <memory>
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "HdlrSlab.hpp"
 #include "UniLog.hpp"
 
 namespace rlib
@@ -33,15 +40,16 @@ template<class aDominoType>
 class MultiHdlrDomino : public aDominoType
 {
 public:
-    using HdlrName  = std::string;
-    using HName_Hdlr_S = std::unordered_map<HdlrName, SharedMsgCB>;
+    using HdlrName = std::string;
 
     explicit MultiHdlrDomino(const LogName& aUniLogName = ULN_DEFAULT) : aDominoType(aUniLogName) {}
+    ~MultiHdlrDomino() noexcept override;  // rm all my hdlrs: invalidate on-road msgs
 
     // -------------------------------------------------------------------------------------------
     // - add multi-hdlr on 1 event
     // . cons: can NOT FreeHdlrDomino::repeatedHdlr() for each hdlr
     // . pros: 1 state, always sync
+    // . hdlrs are called in add order
     // -------------------------------------------------------------------------------------------
     Domino::Event multiHdlrOnSameEv(const Domino::EvName&, MsgCB aHdlr, const HdlrName&) noexcept;
 
@@ -52,16 +60,51 @@ public:
 
 protected:
     void effect_(Domino::Event aEv) noexcept override;  // key/min change other Dominos
-    bool rmOneHdlrOK_(Domino::Event aValidEv, const SharedMsgCB& aValidHdlr) noexcept override; // by aValidHdlr
+    bool rmOneHdlrOK_(Domino::Event aValidEv, HdlrHandle aValidHdlr) noexcept override; // by aValidHdlr
     void rmEv_(Domino::Event aValidEv) noexcept override;
+    size_t nHdlrName_() const noexcept { return name_id_.size(); }  // interned & in use
 
 private:
+    using NameID = uint32_t;
+    struct NameHdlr
+    {
+        NameID     nameID_;
+        uint32_t   order_;  // add order in ev
+        HdlrHandle hdlr_;
+    };
+    using NameHdlrs = std::vector<NameHdlr>;
+    struct Name
+    {
+        const HdlrName* name_;  // key in name_id_ (node-based so stable)
+        uint32_t        nRef_;  // hdlr# w/ this name
+    };
+
+    void   rmMyAllHdlr_(Domino::Event) noexcept;
+    void   sortByAddOrder_(Domino::Event aValidEv) noexcept;
+    NameID internName_(const HdlrName&);  // +1 ref
+    void   releaseName_(NameID) noexcept;  // -1 ref; rm if 0
+    const NameHdlrs* myHdlrs_(Domino::Event aEv) const noexcept
+        { return aEv < ev_hdlrs_.size() && ! ev_hdlrs_[aEv].empty() ? &ev_hdlrs_[aEv] : nullptr; }
+
     // -------------------------------------------------------------------------------------------
-    std::unordered_map<Domino::Event, HName_Hdlr_S> ev_hdlrs_S_;
+    std::vector<NameHdlrs>               ev_hdlrs_;  // [event]=my hdlrs, [HdlrSlab::pos()]=1 hdlr
+    std::unordered_map<HdlrName, NameID> name_id_;   // interned: 1 string per distinct HdlrName in use
+    std::vector<Name>                    id_name_;   // [NameID]=name
+    std::vector<NameID>                  freeIDs_;   // of rm-ed names
+    const Domino::AttrCol                unsortedCol_ = this->newBitAttr_();  // [event]=rm-ed since sorted
 public:
     using aDominoType::oneLog;
 };
 
+// ***********************************************************************************************
+template<class aDominoType>
+MultiHdlrDomino<aDominoType>::~MultiHdlrDomino() noexcept
+{
+    for (auto&& hdlrs : ev_hdlrs_)
+        for (auto&& nameHdlr : hdlrs)
+            HdlrSlab::mt_inst().rmHdlrOK(nameHdlr.hdlr_);
+}
+
 // ***********************************************************************************************
 template<class aDominoType>
 void MultiHdlrDomino<aDominoType>::effect_(Domino::Event aEv) noexcept
@@ -70,17 +113,17 @@ void MultiHdlrDomino<aDominoType>::effect_(Domino::Event aEv) noexcept
     aDominoType::effect_(aEv);
 
     // validate
-    auto&& ev_hdlrs = ev_hdlrs_S_.find(aEv);
-    if (ev_hdlrs == ev_hdlrs_S_.end())
+    auto hdlrs = myHdlrs_(aEv);
+    if (hdlrs == nullptr)
         return;
+    if (this->bitAttr_(unsortedCol_, aEv))
+        sortByAddOrder_(aEv);
 
-    // call my hdlr(s)
-    for (auto&& name_hdlr = ev_hdlrs->second.begin(); name_hdlr != ev_hdlrs->second.end();)
+    // call my hdlr(s): trigger only posts (FreeHdlrDom rm in msg), so hdlrs unchanged here
+    for (auto&& nameHdlr : *hdlrs)
     {
-        auto&& itNext = next(name_hdlr);
-        HID("(MultiHdlrDom) trigger 1 hdlr=" << name_hdlr->first << " of EvName=" << this->evName_(aEv));
-        this->triggerHdlr_(name_hdlr->second, aEv);  // may rm name_hdlr in FreeHdlrDomino
-        name_hdlr = itNext;
+        HID("(MultiHdlrDom) trigger 1 hdlr=" << *id_name_[nameHdlr.nameID_].name_ << " of EvName=" << this->evName_(aEv));
+        this->triggerHdlrFast_(nameHdlr.hdlr_, aEv);
     }
 }
 
@@ -97,20 +140,31 @@ Domino::Event MultiHdlrDomino<aDominoType>::multiHdlrOnSameEv(const Domino::EvNa
     }
 
     // set hdlr
-    auto&& newHdlr = MAKE_PTR<MsgCB>(std::move(aHdlr));
     auto&& ev = this->newEvent(aEvName);
+    if (ev >= ev_hdlrs_.size())
+        ev_hdlrs_.resize(ev + 1);  // except eg bad_alloc: can't recover->terminate
+    auto&& hdlrs = ev_hdlrs_[ev];
 
-    auto [ev_hdlrs, _] = ev_hdlrs_S_.try_emplace(ev);
-    auto [name_hdlr, insertNew] = ev_hdlrs->second.try_emplace(aHdlrName, newHdlr);
-    if (!insertNew)
+    auto&& name_id = name_id_.find(aHdlrName);
+    uint32_t order = 0;
+    for (auto&& nameHdlr : hdlrs)
     {
+        order = std::max(order, nameHdlr.order_ + 1);  // to tail
+        if (name_id == name_id_.end() || nameHdlr.nameID_ != name_id->second)
+            continue;
         WRN("(MultiHdlrDom)!!! Failed since dup EvName=" << aEvName << " + HdlrName=" << aHdlrName);
         return Domino::D_EVENT_FAILED_RET;
     }
+    if (hdlrs.empty())
+        hdlrs.reserve(4);  // most ev has 1~4 hdlrs: 1 alloc than 1->2->4
+    auto&& slab = HdlrSlab::mt_inst();
+    const auto newHdlr = slab.newHdlr(std::move(aHdlr), ev);
+    slab.setPos(newHdlr, uint32_t(hdlrs.size()));
+    hdlrs.push_back({internName_(aHdlrName), order, newHdlr});
     HID("(MultiHdlrDom) Succeed for EvName=" << aEvName << ", HdlrName=" << aHdlrName);
 
     // call hdlr
-    if (this->state(ev))
+    if (this->isEffectEdge_(ev))
     {
         HID("(MultiHdlrDom) Trigger the new hdlr=" << aHdlrName << "of EvName=" << aEvName);
         this->triggerHdlr_(newHdlr, ev);
@@ -119,13 +173,45 @@ Domino::Event MultiHdlrDomino<aDominoType>::multiHdlrOnSameEv(const Domino::EvNa
     return ev;
 }
 
+// ***********************************************************************************************
+template<class aDominoType>
+typename MultiHdlrDomino<aDominoType>::NameID MultiHdlrDomino<aDominoType>::internName_(const HdlrName& aHdlrName)
+{
+    const auto newID = freeIDs_.empty() ? NameID(id_name_.size()) : freeIDs_.back();
+    auto [name_id, insertNew] = name_id_.try_emplace(aHdlrName, newID);  // except eg bad_alloc: can't recover->terminate
+    if (insertNew)
+    {
+        if (newID == id_name_.size())
+            id_name_.push_back({&name_id->first, 0});
+        else
+        {
+            freeIDs_.pop_back();
+            id_name_[newID].name_ = &name_id->first;
+        }
+    }
+    ++id_name_[name_id->second].nRef_;
+    return name_id->second;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void MultiHdlrDomino<aDominoType>::releaseName_(NameID aID) noexcept
+{
+    auto&& name = id_name_[aID];
+    if (--name.nRef_ > 0)
+        return;
+    name_id_.erase(name_id_.find(*name.name_));  // by it: key is in the node to erase
+    name.name_ = nullptr;
+    freeIDs_.push_back(aID);  // except eg bad_alloc: can't recover->terminate
+}
+
 // ***********************************************************************************************
 template<class aDominoType>
 size_t MultiHdlrDomino<aDominoType>::nHdlr(const Domino::EvName& aEN) const noexcept
 {
     const auto ev = this->getEventBy(aEN);
-    auto&& ev_hdlrs = ev_hdlrs_S_.find(ev);
-    return (ev_hdlrs == ev_hdlrs_S_.end() ? 0 : ev_hdlrs->second.size()) + aDominoType::nHdlr_(ev);
+    auto hdlrs = myHdlrs_(ev);
+    return (hdlrs == nullptr ? 0 : hdlrs->size()) + aDominoType::nHdlr_(ev);
 }
 
 // ***********************************************************************************************
@@ -134,56 +220,108 @@ void MultiHdlrDomino<aDominoType>::rmAllHdlr(const Domino::EvName& aEN) noexcept
 {
     const auto ev = this->getEventBy(aEN);
     aDominoType::rmOneHdlrOK_(ev);
-    ev_hdlrs_S_.erase(ev);
+    rmMyAllHdlr_(ev);
 }
 
 // ***********************************************************************************************
 template<typename aDominoType>
 void MultiHdlrDomino<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
 {
-    ev_hdlrs_S_.erase(aValidEv);
+    rmMyAllHdlr_(aValidEv);
     aDominoType::rmEv_(aValidEv);
 }
 
+// ***********************************************************************************************
+template<typename aDominoType>
+void MultiHdlrDomino<aDominoType>::rmMyAllHdlr_(Domino::Event aEv) noexcept
+{
+    if (myHdlrs_(aEv) == nullptr)
+        return;
+    NameHdlrs hdlrs;
+    hdlrs.swap(ev_hdlrs_[aEv]);  // min mem; & safe if rm re-enter
+    this->setBitAttr_(unsortedCol_, aEv, false);
+    for (auto&& nameHdlr : hdlrs)
+    {
+        releaseName_(nameHdlr.nameID_);
+        HdlrSlab::mt_inst().rmHdlrOK(nameHdlr.hdlr_);
+    }
+}
+
 // ***********************************************************************************************
 template<class aDominoType>
 bool MultiHdlrDomino<aDominoType>::rmOneHdlrOK(const Domino::EvName& aEvName, const HdlrName& aHdlrName) noexcept
 {
     // find
-    auto&& ev_hdlrs = ev_hdlrs_S_.find(this->getEventBy(aEvName));
-    if (ev_hdlrs == ev_hdlrs_S_.end())
+    const auto ev = this->getEventBy(aEvName);
+    if (myHdlrs_(ev) == nullptr)
+        return false;
+    auto&& name_id = name_id_.find(aHdlrName);
+    if (name_id == name_id_.end())
         return false;
+    for (auto&& nameHdlr : ev_hdlrs_[ev])
+    {
+        if (nameHdlr.nameID_ != name_id->second)
+            continue;
 
-    // rm
-    INF("(MultiHdlrDom) Succeed to remove HdlrName=" << aHdlrName << " of EvName=" << aEvName);
-    return ev_hdlrs->second.erase(aHdlrName);
+        // rm
+        INF("(MultiHdlrDom) Succeed to remove HdlrName=" << aHdlrName << " of EvName=" << aEvName);
+        return rmOneHdlrOK_(ev, nameHdlr.hdlr_);
+    }
+    return false;
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool MultiHdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aValidEv, const SharedMsgCB& aValidHdlr) noexcept
+bool MultiHdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aValidEv, HdlrHandle aValidHdlr) noexcept
 {
     // parent's hdlr?
     if (aDominoType::rmOneHdlrOK_(aValidEv, aValidHdlr))
         return true;
 
-    // rm
-    auto&& ev_hdlrs = ev_hdlrs_S_.find(aValidEv);
-    // if (ev_hdlrs == ev_hdlrs_S_.end()) return false;  // impossible if valid aValidHdlr
-    for (auto&& name_hdlr = ev_hdlrs->second.begin(); name_hdlr != ev_hdlrs->second.end(); ++name_hdlr)
+    // rm: O(1) by pos
+    if (myHdlrs_(aValidEv) == nullptr)
+        return false;  // impossible if valid aValidHdlr
+    auto&& slab = HdlrSlab::mt_inst();
+    auto&& myHdlrs = ev_hdlrs_[aValidEv];
+    const auto pos = slab.pos(aValidHdlr);
+    if (pos >= myHdlrs.size() || myHdlrs[pos].hdlr_ != aValidHdlr)
+        return false;  // impossible if valid aValidHdlr
+
+    HID("(MultiHdlrDom) Will remove HdlrName=" << *id_name_[myHdlrs[pos].nameID_].name_
+        << " of EvName=" << this->evName_(aValidEv));
+    releaseName_(myHdlrs[pos].nameID_);
+    if (pos + 1 < myHdlrs.size())
     {
-        if (name_hdlr->second != aValidHdlr)
-            continue;
+        myHdlrs[pos] = myHdlrs.back();  // swap-rm: add order by order_, sorted before next effect_()
+        slab.setPos(myHdlrs[pos].hdlr_, pos);
+        this->setBitAttr_(unsortedCol_, aValidEv, true);
+    }
+    myHdlrs.pop_back();
+    if (myHdlrs.empty())
+    {
+        NameHdlrs().swap(myHdlrs);  // min mem (mem safe)
+        this->setBitAttr_(unsortedCol_, aValidEv, false);
+    }
+    slab.rmHdlrOK(aValidHdlr);  // last: may re-enter via cb's destructor
+    return true;
+}
 
-        HID("(MultiHdlrDom) Will remove HdlrName=" << name_hdlr->first << " of EvName=" << this->evName_(aValidEv)
-            << ", nHdlrRef=" << name_hdlr->second.use_count());
-        if (ev_hdlrs->second.size() > 1)
-            ev_hdlrs->second.erase(name_hdlr);
-        else
-            ev_hdlrs_S_.erase(ev_hdlrs);  // min mem (mem safe)
-        return true;
+// ***********************************************************************************************
+// - small (1~4 hdlrs) & only after rm: insertion sort, renumber order_ (no overflow by churn)
+template<class aDominoType>
+void MultiHdlrDomino<aDominoType>::sortByAddOrder_(Domino::Event aValidEv) noexcept
+{
+    auto&& slab = HdlrSlab::mt_inst();
+    auto&& myHdlrs = ev_hdlrs_[aValidEv];
+    for (size_t i = 1; i < myHdlrs.size(); ++i)
+        for (size_t j = i; j > 0 && myHdlrs[j - 1].order_ > myHdlrs[j].order_; --j)
+            std::swap(myHdlrs[j - 1], myHdlrs[j]);
+    for (uint32_t i = 0; i < myHdlrs.size(); ++i)
+    {
+        myHdlrs[i].order_ = i;
+        slab.setPos(myHdlrs[i].hdlr_, i);
     }
-    return false;  // impossible if valid aValidHdlr
+    this->setBitAttr_(unsortedCol_, aValidEv, false);
 }
 
 }  // namespace
@@ -202,4 +340,14 @@ bool MultiHdlrDomino<aDominoType>::rmOneHdlrOK_(Domino::Event aValidEv, const Sh
 // 2023-05-29  CSZ       - rmAllHdlr
 // 2025-02-13  CSZ       - support both SafePtr & shared_ptr
 // 2025-04-05  CSZ       3)tolerate exception
+// 2026-10-18  CSZ       - HdlrSlab handle than SharedMsgCB
+//                       - dense [ev]=hdlrs in add order + interned HdlrName than 2-level hash map
+//                       - immediate call by edge (HdlrDomino::setEdge)
+// 2026-10-19  CSZ       - static triggerHdlr_() for StaticDom
+//                       - O(1) rm by HdlrSlab::pos(); ref-cnt interned HdlrName
 // ***********************************************************************************************
+// - why sort lazily in effect_() than keep add order at rm?
+//   . rm (eg FreeHdlrDom rm-then-call per call) is hot; erase() shifts the rest & needs a linear find
+//   . sort only if rm-ed since last effect_(), in 1~4 hdlrs
+// - why ref-cnt interned HdlrName?
+//   . HdlrName is mostly owner's name (few & reused), but generated names (eg per session) would leak
@@ -8,13 +8,12 @@
 // - why/VALUE:
 //   . separate class to lighten Domino (let PriDomino & Domin to focus it own)
 //   * priority call hdlr rather than FIFO in Domino [MUST-HAVE!]
-// - core: ev_pri_S_
+// - core: priCol_
 // - class safe: yes
 //   . forbid change flag when hdlr available, avoid confusing scenario eg  hdlr on-road
 // ***********************************************************************************************
 #pragma once
 
-#include <unordered_map>
 #include "UniLog.hpp"
 
 namespace rlib
@@ -32,12 +31,12 @@ public:
     // -------------------------------------------------------------------------------------------
     [[nodiscard]] EMsgPriority  getPriority(Domino::Event) const noexcept override;  // key/min change other Dominos
     Domino::Event setPriority(const Domino::EvName&, const EMsgPriority) noexcept;
-protected:
-    void rmEv_(Domino::Event aValidEv) noexcept override;
 
 private:
     // -------------------------------------------------------------------------------------------
-    std::unordered_map<Domino::Event, EMsgPriority> ev_pri_S_;  // [event]=priority; most default so better than vector
+    // - byte column in Domino's attr store: [event]=priority+1; 0=default (auto when rm ev)
+    // - 1B/ev dense than unordered_map (~40B/non-default ev + hash on each hdlr call)
+    const Domino::AttrCol priCol_ = this->newByteAttr_();
 public:
     using aDominoType::oneLog;
 };
@@ -46,20 +45,12 @@ public:
 template<class aDominoType>
 EMsgPriority PriDomino<aDominoType>::getPriority(Domino::Event aEv) const noexcept
 {
-    auto&& ev_pri = ev_pri_S_.find(aEv);
-    return ev_pri != ev_pri_S_.end()
-        ? ev_pri->second
+    const auto priPlus1 = this->byteAttr_(priCol_, aEv);
+    return priPlus1 > 0
+        ? EMsgPriority(priPlus1 - 1)
         : aDominoType::getPriority(aEv);  // default
 }
 
-// ***********************************************************************************************
-template<typename aDominoType>
-void PriDomino<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
-{
-    ev_pri_S_.erase(aValidEv);
-    aDominoType::rmEv_(aValidEv);
-}
-
 // ***********************************************************************************************
 template<class aDominoType>
 Domino::Event PriDomino<aDominoType>::setPriority(const Domino::EvName& aEvName, const EMsgPriority aPri) noexcept
@@ -74,9 +65,9 @@ Domino::Event PriDomino<aDominoType>::setPriority(const Domino::EvName& aEvName,
     HID("(PriDom) EvName=" << aEvName << ", newPri=" << size_t(aPri));
     auto&& event = this->newEvent(aEvName);
     if (aPri == aDominoType::getPriority(event))
-        ev_pri_S_.erase(event);  // less mem & faster searching
+        this->setByteAttr_(priCol_, event, 0);  // back to default
     else if (aPri < EMsgPri_MAX)
-        ev_pri_S_[event] = aPri;
+        this->setByteAttr_(priCol_, event, uint8_t(aPri + 1));
     return event;
 }
 
@@ -91,4 +82,5 @@ Domino::Event PriDomino<aDominoType>::setPriority(const Domino::EvName& aEvName,
 // 2022-03-27  CSZ       - if ut case can test base class, never specify derive
 // 2022-08-18  CSZ       - replace CppLog by UniLog
 // 2025-04-05  CSZ       2)tolerate exception
+// 2026-10-18  CSZ       - attr column in Domino (than own container & rmEv_)
 // ***********************************************************************************************
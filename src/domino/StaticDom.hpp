@@ -0,0 +1,119 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - ISSUE: MaxDom = WbasicDatDom<MultiHdlrDomino<...HdlrDomino<RmEvDom<Domino>>...>>
+//   . per ev in a wave: Domino calls effect_() virtually; then per hdlr, triggerHdlr_() & getPriority()
+//     virtually again - compiler can't inline across layers
+//
+// - how: CRTP composition = final type known by core loop & layers
+//   . bottom StaticCore<Final> (than Domino): tells every layer FinalType
+//   . top StaticDom<...> registers 1 static wave loop in Domino: qualified Final::effect_() per ev
+//   . layers' hot hooks (HdlrDomino::triggerHdlrFast_/getPriorityFast_) call Final:: qualified
+//   . so no virtual per ev/hdlr, whole chain can inline; cold path (rmEv_, nHdlr...) keeps virtual
+//
+// - how to use: same layers, Final shall be final (qualified call = its final overrider):
+//     struct MyDom final
+//         : public StaticDom<MultiHdlrDomino<PriDomino<HdlrDomino<StaticCore<MyDom>>>>>
+//     {
+//         explicit MyDom(const LogName& aUniLogName = ULN_DEFAULT) : StaticDom(aUniLogName) {}
+//     };
+//
+// - core: st_wave_()
+// - class safe: yes
+// ***********************************************************************************************
+#pragma once
+
+#include <type_traits>
+
+#include "Domino.hpp"
+#include "HdlrSlab.hpp"
+#include "MsgSelf.hpp"
+#include "UniLog.hpp"
+
+namespace rlib
+{
+template<class aDominoType> class HdlrDomino;
+template<class aDominoType> class MultiHdlrDomino;
+
+// ***********************************************************************************************
+template<class aFinal>
+class StaticCore : public Domino
+{
+public:
+    explicit StaticCore(const LogName& aUniLogName = ULN_DEFAULT) noexcept : Domino(aUniLogName) {}
+
+protected:
+    using FinalType = aFinal;
+};
+
+// ***********************************************************************************************
+template<class aDominoType>
+class StaticDom : public aDominoType
+{
+    using Final = typename aDominoType::FinalType;
+    static_assert(! std::is_void_v<Final>, "REQ: bottom shall be StaticCore<Final>");
+
+public:
+    explicit StaticDom(const LogName& aUniLogName = ULN_DEFAULT);
+
+protected:
+    static void st_wave_(Domino&, const Domino::EVs& aEffectEVs) noexcept;
+    static void st_triggerHdlr_(Domino&, HdlrHandle aValidHdlr, Domino::Event aValidEv) noexcept;
+    static EMsgPriority st_getPriority_(const Domino&, Domino::Event aEv) noexcept;
+
+    template<class> friend class HdlrDomino;
+    template<class> friend class MultiHdlrDomino;
+
+public:
+    using aDominoType::oneLog;
+};
+
+// ***********************************************************************************************
+template<class aDominoType>
+StaticDom<aDominoType>::StaticDom(const LogName& aUniLogName)
+    : aDominoType(aUniLogName)
+{
+    static_assert(std::is_final_v<Final>, "REQ: Final::xxx() shall be the final overrider");
+    static_assert(std::is_base_of_v<StaticDom, Final>);
+    this->setStaticWave_(&st_wave_);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+EMsgPriority StaticDom<aDominoType>::st_getPriority_(const Domino& aDom, Domino::Event aEv) noexcept
+{
+    return static_cast<const Final&>(aDom).Final::getPriority(aEv);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void StaticDom<aDominoType>::st_triggerHdlr_(Domino& aDom, HdlrHandle aValidHdlr, Domino::Event aValidEv) noexcept
+{
+    static_cast<Final&>(aDom).Final::triggerHdlr_(aValidHdlr, aValidEv);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void StaticDom<aDominoType>::st_wave_(Domino& aDom, const Domino::EVs& aEffectEVs) noexcept
+{
+    auto&& self = static_cast<Final&>(aDom);
+    for (auto&& ev : aEffectEVs)
+        if (self.isEffectEdge_(ev))  // same as Domino::effect_()
+            self.Final::effect_(ev);
+}
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-19  CSZ       1)create
+// ***********************************************************************************************
+// - why FinalType from bottom (StaticCore) than a 2nd template para of each layer?
+//   . layers & all their users unchanged; dyn stack (bottom Domino: FinalType=void) keeps virtual
+// - why 1 fn ptr call per wave than virtual?
+//   . dyn dom pays only a null check per wave; Domino core stays non-template (Domino.cpp)
+// - why st_xxx() static in StaticDom than called directly by layer?
+//   . Final's protected hooks are accessible in StaticDom (Final's base), not in a lower layer
@@ -6,13 +6,11 @@
 // ***********************************************************************************************
 // - what:     simple/easy write-protect for DataDomino
 // - why:      eg Yang RW para need write-protect
-// - core:     wrCtrl_
+// - core:     wrCtrlCol_
 // - mem-safe: true (when use SafePtr instead of shared_ptr)
 // ***********************************************************************************************
 #pragma once
 
-#include <vector>
-
 #include "UniLog.hpp"
 #include "UniPtr.hpp"
 
@@ -34,16 +32,13 @@ public:
     [[nodiscard]] bool replaceDataOK(const Domino::EvName&, S_PTR<void> aData = nullptr) noexcept override;
     [[nodiscard]] bool wbasic_replaceDataOK(const Domino::EvName&, S_PTR<void> aData = nullptr) noexcept;
 
-protected:
-    void rmEv_(Domino::Event aValidEv) noexcept override;
-
 private:
     // forbid ouside use base directly
     using aDominoType::getData;
     using aDominoType::replaceDataOK;
-    bool isWrCtrl_(Domino::Event aEv) const noexcept { return aEv < wrCtrl_.size() ? wrCtrl_[aEv] : false; }
+    bool isWrCtrl_(Domino::Event aEv) const noexcept { return this->bitAttr_(wrCtrlCol_, aEv); }
     // -------------------------------------------------------------------------------------------
-    std::vector<bool> wrCtrl_;
+    const Domino::AttrCol wrCtrlCol_ = this->newBitAttr_();  // [event]=t/f; auto clear when rm ev
 
 public:
     using aDominoType::oneLog;
@@ -78,16 +73,6 @@ bool WbasicDatDom<aDominoType>::replaceDataOK(const Domino::EvName& aEvName, S_P
     else return aDominoType::replaceDataOK(aEvName, std::move(aData));
 }
 
-// ***********************************************************************************************
-template<typename aDominoType>
-void WbasicDatDom<aDominoType>::rmEv_(Domino::Event aValidEv) noexcept
-{
-    if (aValidEv < wrCtrl_.size())
-        wrCtrl_[aValidEv] = false;
-
-    aDominoType::rmEv_(aValidEv);
-}
-
 // ***********************************************************************************************
 template<typename aDominoType>
 S_PTR<void> WbasicDatDom<aDominoType>::wbasic_getData(const Domino::EvName& aEvName) const noexcept
@@ -122,11 +107,8 @@ bool WbasicDatDom<aDominoType>::wrCtrlOk(const Domino::EvName& aEvName, const bo
         return false;
     }
 
-    if (ev >= wrCtrl_.size())
-        wrCtrl_.resize(ev + 1);  // resize() can inc size()
-    wrCtrl_[ev] = aNewState;
-    HID("(WbasicDatDom) Succeed, EvName=" << aEvName << ", new wrCtrl=" << aNewState
-        << ", nWr=" << wrCtrl_.size() << ", cap=" << wrCtrl_.capacity());
+    this->setBitAttr_(wrCtrlCol_, ev, aNewState);
+    HID("(WbasicDatDom) Succeed, EvName=" << aEvName << ", new wrCtrl=" << aNewState);
     return true;
 }
 
@@ -170,4 +152,5 @@ template<typename aDataDominoType, typename aDataType>
 // 2024-02-12  CSZ       2)use SafePtr (mem-safe); shared_ptr is not mem-safe
 // 2025-02-13  CSZ       - support both SafePtr & shared_ptr
 // 2025-03-29  CSZ       3)tolerate exception
+// 2026-10-18  CSZ       - attr column in Domino (than own container & rmEv_)
 // ***********************************************************************************************
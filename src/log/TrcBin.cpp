@@ -0,0 +1,100 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include "TrcBin.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+bool TrcBin::setFileOK(const string& aFileName) noexcept
+{
+    thBuf_.flush();  // to old file (or drop if none)
+    FILE* newFp = nullptr;
+    if (! aFileName.empty())
+    {
+        newFp = fopen(aFileName.c_str(), "wb");
+        if (newFp == nullptr)
+        {
+            cout << "ERR(TrcBin): can't open trace file " << aFileName << endl;
+            return false;
+        }
+        fwrite(MAGIC, 1, sizeof(MAGIC), newFp);
+        fwrite(&ENDIAN_MARK, 1, sizeof(ENDIAN_MARK), newFp);
+    }
+
+    lock_guard<mutex> guard(fmtMutex_);  // new file shall have all fmt before any log rec
+    if (newFp)
+        for (size_t id = 0; id < fmts_.size(); ++id)
+            writeFmt_(newFp, uint32_t(id), fmts_[id]);
+
+    auto* oldFp = mt_fp_.exchange(newFp, memory_order_acq_rel);
+    if (oldFp)
+        fclose(oldFp);
+    return true;
+}
+
+// ***********************************************************************************************
+void TrcBin::mt_flush() noexcept
+{
+    thBuf_.flush();
+    if (auto* fp = mt_fp_.load(memory_order_acquire))
+        fflush(fp);
+}
+
+// ***********************************************************************************************
+uint32_t TrcBin::mt_newFmtId_(const char* aFmt) noexcept
+{
+    lock_guard<mutex> guard(fmtMutex_);
+    const auto id = uint32_t(fmts_.size());
+    fmts_.push_back(aFmt);  // except eg bad_alloc: can't recover->terminate
+
+    // direct to file (not thBuf_): precede any log rec of this id from any thread
+    if (auto* fp = mt_fp_.load(memory_order_acquire))
+        writeFmt_(fp, id, aFmt);
+    return id;
+}
+
+// ***********************************************************************************************
+void TrcBin::writeFmt_(FILE* aFp, uint32_t aId, const char* aFmt) noexcept
+{
+    const auto len = uint16_t(strnlen(aFmt, UINT16_MAX));
+    char head[1 + sizeof(aId) + sizeof(len)];
+    char* pos = head;
+    *pos++ = 'F';
+    put_(pos, aId);
+    put_(pos, len);
+    fwrite(head, 1, sizeof(head), aFp);
+    fwrite(aFmt, 1, len, aFp);
+}
+
+// ***********************************************************************************************
+void TrcBin::ThBuf::flush() noexcept
+{
+    if (n == 0)
+        return;
+    if (auto* fp = mt_fp_.load(memory_order_acquire))
+        fwrite(data.get(), 1, n, fp);  // fwrite MT safe per C11
+    n = 0;
+}
+
+// ***********************************************************************************************
+thread_local TrcBin::ThBuf TrcBin::thBuf_;
+atomic<FILE*>              TrcBin::mt_fp_ = nullptr;
+mutex                      TrcBin::fmtMutex_;
+vector<const char*>        TrcBin::fmts_;
+
+// env var TRACE_BIN=fileName: binary TRC w/o code change
+static const bool kTraceBin = [] {
+    const char* fileName = getenv("TRACE_BIN");
+    return fileName && TrcBin::setFileOK(fileName);
+}();
+
+}  // namespaces
@@ -0,0 +1,183 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - ISSUE/why:
+//   . TRC() = hot-path event log, but each call snprintf(timestamp + msg) + fwrite
+//   . ~30% of total Domino time (see GOLD_perf_mem)
+//
+// - how: deferred format
+//   . hot path: only copy {fmt id, raw timestamp, raw args} into per-thread buf (no snprintf)
+//   . fmt string is written once (dictionary record) when its TRC() call site 1st runs
+//   . offline: tools/dom_gantt.py decodes binary -> same text as TRC (or direct -> gantt)
+//
+// - opt-in: TrcBin::setFileOK(fileName) or env var TRACE_BIN=fileName
+//   . else TRC() keeps text output (unchanged)
+//
+// - file format (native endian; checked by ENDIAN_MARK):
+//   . header: MAGIC[8] + u32 ENDIAN_MARK
+//   . fmt rec: 'F' + u32 id + u16 len + char[len]
+//   . log rec: 'R' + u32 id + i64 system_clock ns + u8 nArg + nArg * (u8 tag + payload)
+//     . tag 'i'=i64, 'u'=u64, 'd'=double, 'c'=char, 'p'=u64 ptr, 's'=u8 len + char[len]
+//
+// - core: thBuf_
+//
+// - MT safe: yes
+//   . log rec: thread_local buf, fwrite when full / thread exit / mt_flush()
+//   . fmt rec: mutex (rare: once per call site)
+//   . recs from diff threads are not time-ordered in file; decoder sorts by timestamp
+// - mem safe: yes
+// ***********************************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rlib
+{
+// ***********************************************************************************************
+class TrcBin
+{
+public:
+    // - empty aFileName: back to text TRC
+    // - MT safe: yes, but TRC() in other thread shall stop before (same as UniCoutLog::setLogFileOK)
+    [[nodiscard]] static bool setFileOK(const std::string& aFileName) noexcept;
+    static bool mt_on() noexcept { return mt_fp_.load(std::memory_order_relaxed) != nullptr; }
+    static void mt_flush() noexcept;  // calling thread's buf only
+
+    // - for TRC_BIN() only
+    template<class... Args> static uint32_t mt_fmtId(const char* aFmt, const Args&...) noexcept;
+    template<class... Args> static void mt_write(uint32_t aFmtId, const char*, Args... aArgs) noexcept;
+
+    static constexpr char     MAGIC[8]    = {'D', 'O', 'M', 'T', 'R', 'C', 'B', '1'};
+    static constexpr uint32_t ENDIAN_MARK = 0x01020304;
+    static constexpr size_t   MAX_STR     = 255;  // per %s, like text TRC's truncation
+
+private:
+    static uint32_t mt_newFmtId_(const char* aFmt) noexcept;
+    static void writeFmt_(std::FILE* aFp, uint32_t aId, const char* aFmt) noexcept;
+
+    template<class T> static void put_(char*& aPos, const T& aVal) noexcept
+    {
+        std::memcpy(aPos, &aVal, sizeof(aVal));
+        aPos += sizeof(aVal);
+    }
+    template<class T> static void putArg_(char*& aPos, T aArg) noexcept;
+
+    // -------------------------------------------------------------------------------------------
+    struct ThBuf
+    {
+        ~ThBuf() { flush(); }  // thread exit: not lose tail
+        void flush() noexcept;
+
+        static constexpr size_t SIZE = 64 * 1024;  // alloc on 1st use: no cost for non-TRC threads
+        std::unique_ptr<char[]> data;
+        size_t n = 0;
+    };
+    static thread_local ThBuf thBuf_;
+
+    static std::atomic<std::FILE*> mt_fp_;
+    static std::mutex              fmtMutex_;
+    static std::vector<const char*> fmts_;  // [id]=fmt; rewrite all to new file
+};
+
+// ***********************************************************************************************
+template<class... Args>
+uint32_t TrcBin::mt_fmtId(const char* aFmt, const Args&...) noexcept
+{
+    return mt_newFmtId_(aFmt);
+}
+
+// ***********************************************************************************************
+template<class... Args>
+void TrcBin::mt_write(uint32_t aFmtId, const char*, Args... aArgs) noexcept
+{
+    static_assert(sizeof...(Args) <= UINT8_MAX, "too many TRC args");
+    constexpr size_t maxLen = 1 + 4 + 8 + 1 + sizeof...(Args) * (1 + 1 + MAX_STR);
+
+    auto& buf = thBuf_;
+    if (buf.n + maxLen > ThBuf::SIZE)
+        buf.flush();
+    if (! buf.data)
+        buf.data = std::make_unique<char[]>(ThBuf::SIZE);  // except eg bad_alloc: can't recover->terminate
+
+    char* pos = buf.data.get() + buf.n;
+    *pos++ = 'R';
+    put_(pos, aFmtId);
+    put_(pos, int64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count()));
+    *pos++ = char(sizeof...(Args));
+    (putArg_(pos, aArgs), ...);
+    buf.n = pos - buf.data.get();
+}
+
+// ***********************************************************************************************
+// - by printf's default argument promotion
+template<class T>
+void TrcBin::putArg_(char*& aPos, T aArg) noexcept
+{
+    if constexpr(std::is_same_v<T, const char*> || std::is_same_v<T, char*>)
+    {
+        const char* str = aArg ? aArg : "(null)";
+        const auto len = uint8_t(strnlen(str, MAX_STR));
+        *aPos++ = 's';
+        *aPos++ = char(len);
+        std::memcpy(aPos, str, len);
+        aPos += len;
+    }
+    else if constexpr(std::is_same_v<T, char>)
+    {
+        *aPos++ = 'c';
+        *aPos++ = aArg;
+    }
+    else if constexpr(std::is_pointer_v<T>)
+    {
+        *aPos++ = 'p';
+        put_(aPos, uint64_t(reinterpret_cast<uintptr_t>(aArg)));
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+        *aPos++ = 'd';
+        put_(aPos, double(aArg));
+    }
+    else if constexpr(std::is_enum_v<T>)
+        putArg_(aPos, std::underlying_type_t<T>(aArg));
+    else if constexpr(std::is_unsigned_v<T> && ! std::is_same_v<T, bool>)
+    {
+        *aPos++ = 'u';
+        put_(aPos, uint64_t(aArg));
+    }
+    else
+    {
+        static_assert(std::is_integral_v<T>, "unsupported TRC arg type");
+        *aPos++ = 'i';
+        put_(aPos, int64_t(aArg));
+    }
+}
+
+}  // namespace
+
+// ***********************************************************************************************
+// - static id per TRC() call site: register fmt only once (magic static is MT safe)
+#define TRC_BIN(...) do { static const uint32_t trcBinId_ = rlib::TrcBin::mt_fmtId(__VA_ARGS__); \
+    rlib::TrcBin::mt_write(trcBinId_, __VA_ARGS__); } while(0)
+
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// ***********************************************************************************************
+// - why not rdtsc for timestamp?
+//   . system_clock::now() is vDSO (~20ns), no calibration needed by decoder
+// - why not compress args (eg varint)?
+//   . hot path cost > file size gain; TRC file is for offline analysis only
@@ -46,6 +46,7 @@ using LogName = std::string;
 //   . -19% perf gain: TRC(fwrite) vs INF(out_->write())
 //     type-safe composable formatting that printf can't match
 // - runtime switch: env var TRACE_OFF=1 disables TRC for pure-computation profiling
+// - binary TRC (TrcBin.hpp): env var TRACE_BIN=fileName, no snprintf on hot path
 namespace rlib { inline bool traceOn_ = (std::getenv("TRACE_OFF") == nullptr); }
 #define TRC(...) ((void)0)  // dummy, will be replaced by real
 
@@ -157,4 +158,5 @@ constexpr char ULN_DEFAULT[] = "DEFAULT";
 // 2024-02-22  CSZ       2)mem-safe
 // 2025-04-07  CSZ       3)tolerate exception; MT safe
 // 2026-04-17  CSZ       4)TRC; perf opt other logs
+// 2026-10-18  CSZ       - binary TRC
 // ***********************************************************************************************
@@ -23,6 +23,7 @@
 #include <fstream>
 #include <iostream>
 
+#include "TrcBin.hpp"
 #include "UniBaseLog.hpp"
 
 namespace rlib
@@ -84,8 +85,11 @@ using UniLog = UniCoutLog;
 // ***********************************************************************************************
 // - override TRC fallback
 // - branch-predict: traceOn_ rarely flips -> well-predicted, ~0 overhead when enabled
+// - TrcBin::mt_on(): binary deferred-format TRC instead of text (see TrcBin.hpp)
 #undef TRC
-#define TRC(...) do { if (rlib::traceOn_) rlib::UniCoutLog::trcPrintf(__VA_ARGS__); } while(0)
+#define TRC(...) do { if (rlib::traceOn_) { \
+    if (rlib::TrcBin::mt_on()) TRC_BIN(__VA_ARGS__); \
+    else rlib::UniCoutLog::trcPrintf(__VA_ARGS__); } } while(0)
 
 // ***********************************************************************************************
 // YYYY-MM-DD  Who       v)Modification Description
@@ -95,4 +99,5 @@ using UniLog = UniCoutLog;
 // 2024-02-21  CSZ       2)mem-safe
 // 2025-04-07  CSZ       3)tolerate exception
 // 2026-03-13  CSZ       4)log to file than cout
+// 2026-10-18  CSZ       - binary TRC
 // ***********************************************************************************************
@@ -25,6 +25,7 @@
 #include <unordered_map>
 
 #include "StrCoutFSL.hpp"
+#include "TrcBin.hpp"
 #include "UniBaseLog.hpp"
 
 namespace rlib
@@ -93,8 +94,11 @@ using UniLog = UniSmartLog;
 // - override TRC fallback: bind to UniSmartLog::trcPrintf
 //   . TRC is static -> always writes to defaultUniLog_ (DEFAULT), not per-instance LogName
 //   . INF/WRN/ERR use oneLog() -> writes to instance's LogName
+// - TrcBin::mt_on(): binary deferred-format TRC instead of text (see TrcBin.hpp)
 #undef TRC
-#define TRC(...) do { if (rlib::traceOn_) rlib::UniSmartLog::trcPrintf(__VA_ARGS__); } while(0)
+#define TRC(...) do { if (rlib::traceOn_) { \
+    if (rlib::TrcBin::mt_on()) TRC_BIN(__VA_ARGS__); \
+    else rlib::UniSmartLog::trcPrintf(__VA_ARGS__); } } while(0)
 
 // ***********************************************************************************************
 // YYYY-MM-DD  Who       v)Modification Description
@@ -103,4 +107,5 @@ using UniLog = UniSmartLog;
 // 2022-12-02  CSZ       - simple & natural
 // 2024-02-21  CSZ       2)mem-safe
 // 2025-04-07  CSZ       3)tolerate exception
+// 2026-10-18  CSZ       - binary TRC
 // ***********************************************************************************************
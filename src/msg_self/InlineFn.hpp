@@ -0,0 +1,120 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: move-only void() callable w/ aInlineSz bytes inline (std::function: 16B in libstdc++)
+// - why: MsgSelf's common msg (eg lambda of {dom*, handle, vector}) shall never touch heap
+// - how:
+//   . fn fits (size, align, nothrow move) -> placement new in buf_; else heap & ptr in buf_
+//   . 1 static Ops table per fn type (call/move/destroy): 1 ptr than vtable+obj
+//   . move-only: no copy of captured resrc (eg vector), std::function requires copyable
+//
+// - MT safe: no (as std::function)
+// ***********************************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rlib
+{
+// ***********************************************************************************************
+template<size_t aInlineSz>
+class InlineFn
+{
+public:
+    InlineFn() noexcept = default;
+    ~InlineFn() noexcept { reset(); }
+
+    template<class aFn, class = std::enable_if_t<! std::is_same_v<std::decay_t<aFn>, InlineFn>>>
+    InlineFn(aFn&& aCallable) noexcept(isInline<std::decay_t<aFn>>())  // except eg bad_alloc if heap
+    {
+        using Fn = std::decay_t<aFn>;
+        if constexpr (isInline<Fn>())
+            new (buf_) Fn(std::forward<aFn>(aCallable));
+        else
+            *reinterpret_cast<Fn**>(buf_) = new Fn(std::forward<aFn>(aCallable));
+        ops_ = &OPS<Fn>;
+    }
+
+    InlineFn(InlineFn&& aOther) noexcept { moveFrom_(aOther); }
+    InlineFn& operator=(InlineFn&& aOther) noexcept
+    {
+        if (this != &aOther)
+        {
+            reset();
+            moveFrom_(aOther);
+        }
+        return *this;
+    }
+    InlineFn(const InlineFn&)            = delete;
+    InlineFn& operator=(const InlineFn&) = delete;
+
+    void operator()() { ops_->call_(buf_); }
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+    void reset() noexcept
+    {
+        if (ops_)
+            ops_->destroy_(buf_);
+        ops_ = nullptr;
+    }
+
+    template<class aFn> static constexpr bool isInline() noexcept
+    {
+        return sizeof(aFn) <= aInlineSz && alignof(std::max_align_t) % alignof(aFn) == 0
+            && std::is_nothrow_move_constructible_v<aFn>;
+    }
+
+private:
+    struct Ops
+    {
+        void (*call_)(void*);
+        void (*move_)(void* aDst, void* aSrc) noexcept;  // & destroy src
+        void (*destroy_)(void*) noexcept;
+    };
+    template<class aFn> static constexpr Ops makeOps_() noexcept
+    {
+        if constexpr (isInline<aFn>())
+            return {
+                [](void* aBuf) { (*static_cast<aFn*>(aBuf))(); },
+                [](void* aDst, void* aSrc) noexcept {
+                    new (aDst) aFn(std::move(*static_cast<aFn*>(aSrc)));
+                    static_cast<aFn*>(aSrc)->~aFn();
+                },
+                [](void* aBuf) noexcept { static_cast<aFn*>(aBuf)->~aFn(); }
+            };
+        else
+            return {
+                [](void* aBuf) { (**static_cast<aFn**>(aBuf))(); },
+                [](void* aDst, void* aSrc) noexcept { *static_cast<aFn**>(aDst) = *static_cast<aFn**>(aSrc); },
+                [](void* aBuf) noexcept { delete *static_cast<aFn**>(aBuf); }
+            };
+    }
+    template<class aFn> static constexpr Ops OPS = makeOps_<aFn>();
+
+    void moveFrom_(InlineFn& aOther) noexcept
+    {
+        ops_ = aOther.ops_;
+        if (ops_)
+            ops_->move_(buf_, aOther.buf_);
+        aOther.ops_ = nullptr;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    static_assert(aInlineSz >= sizeof(void*), "REQ: at least a heap ptr");
+    alignas(std::max_align_t) unsigned char buf_[aInlineSz];
+    const Ops* ops_ = nullptr;
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// ***********************************************************************************************
+// - why not std::move_only_function (C++23)?
+//   . lib is C++17; & its inline size is impl-defined (not configurable)
@@ -0,0 +1,92 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: lock-free multi-producer single-consumer FIFO (Dmitry Vyukov's node-based queue)
+// - why: any thread -> main thread w/o mutex (MtInQueue: mutex + deque + type_index per ele)
+// - how:
+//   . mt_emplaceOK(): 1 heap node + 1 atomic exchange on head_ (wait-free, no CAS retry loop)
+//   . pop(): main thread follows tail_->next_; old tail (consumed stub) freed (except init_)
+//   . a producer between exchange & link makes pop() see "empty" briefly: it pings after link,
+//     so consumer gets it next round (no lost ele)
+//
+// - MT safe: mt_emplaceOK() any thread; pop()/dtor consumer thread ONLY
+// ***********************************************************************************************
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace rlib
+{
+// ***********************************************************************************************
+template<class T>
+class MpscQ
+{
+public:
+    MpscQ() noexcept = default;
+    ~MpscQ() noexcept
+    {
+        while (tail_)
+            free_(std::exchange(tail_, tail_->next_.load(std::memory_order_acquire)));
+    }
+    MpscQ(const MpscQ&)            = delete;
+    MpscQ& operator=(const MpscQ&) = delete;
+
+    // - construct T in node (no move); aValid(const T&) false -> not pushed
+    template<class aValid, class... aArg> [[nodiscard]] bool mt_emplaceOK(aValid&& aIsValid, aArg&&... aArgs) noexcept
+    {
+        auto node = new(std::nothrow) Node(std::forward<aArg>(aArgs)...);
+        if (! node)
+            return false;  // ut can't cover this branch; rare but safer
+        if (! aIsValid(std::as_const(node->ele_)))
+        {
+            delete node;
+            return false;
+        }
+        head_.exchange(node, std::memory_order_acq_rel)->next_.store(node, std::memory_order_release);
+        return true;
+    }
+    [[nodiscard]] bool pop(T& aEle) noexcept
+    {
+        const auto next = tail_->next_.load(std::memory_order_acquire);
+        if (! next)
+            return false;
+        aEle = std::move(next->ele_);  // next becomes stub
+        free_(std::exchange(tail_, next));
+        return true;
+    }
+
+private:
+    struct Node
+    {
+        template<class... aArg> explicit Node(aArg&&... aArgs) : ele_{std::forward<aArg>(aArgs)...} {}
+
+        std::atomic<Node*> next_{nullptr};
+        T ele_;
+    };
+    void free_(Node* aNode) noexcept
+    {
+        if (aNode != &init_)
+            delete aNode;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    Node init_;  // 1st stub: no alloc in ctor
+    alignas(64) std::atomic<Node*> head_{&init_};  // last pushed; own cache line: producers only
+    alignas(64) Node* tail_ = &init_;              // stub: its next_ is the 1st to pop
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+// ***********************************************************************************************
+// - why not bounded ring (eg Vyukov MPMC array)?
+//   . full -> usr must retry/drop; MsgSelf never limits queue size (as std lib)
+// - why not a node pool?
+//   . pool free list is multi-producer too (ABA); malloc's per-thread cache is already that
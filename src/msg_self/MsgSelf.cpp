@@ -5,48 +5,275 @@
  */
 // ***********************************************************************************************
 #include "MsgSelf.hpp"
+#include "TimerWheel.hpp"
 
 namespace rlib
 {
+// ***********************************************************************************************
+MsgSelf::MsgSelf(const LogName& aUniLogName) noexcept : UniLog(aUniLogName)
+{
+    resetStats();
+}
+
+// ***********************************************************************************************
+MsgSelf::~MsgSelf() noexcept
+{
+    if (nMsg_)
+        WRN("discard nMsg=" << nMsg_);
+    if (! timedMsgs_.empty())
+        WRN("discard nTimer=" << timedMsgs_.size());
+}
+
 // ***********************************************************************************************
 void MsgSelf::handleAllMsg() noexcept
 {
+    mergeIntake_();
+    advanceTimers_(std::chrono::steady_clock::now());
     while (handleOneMsg_());  // handleOneMsg_() may create new high priority msg(s)
 }
 
 // ***********************************************************************************************
-bool MsgSelf::handleOneMsg_() noexcept
+size_t MsgSelf::handleMsgFor(const std::chrono::nanoseconds aBudget) noexcept
 {
-    for (int msgPri = EMsgPri_MAX - 1; msgPri >= EMsgPri_MIN; --msgPri)
+    const auto now = std::chrono::steady_clock::now();
+    const auto deadline = now + aBudget;
+    mergeIntake_();
+    advanceTimers_(now);
+    size_t nHandled = 0;
+    for (bool more = nMsg_ > 0; more; ++nHandled)
     {
-        auto&& oneQueue = msgQueues_[msgPri];
-        if (oneQueue.empty())
-            continue;
-
-        auto msg = std::move(oneQueue.front());
-        oneQueue.pop_front();  // except can't recover->terminate
-        --nMsg_;
-
-        try { msg(); } // run 1st MsgCB; newMsgOK() prevent nullptr into msgQueues_
-        catch(...) { ERR("(MsgSelf) msg() except=" << mt_exceptInfo()); }
+        if (nHandled > 0 && std::chrono::steady_clock::now() >= deadline)
+        {
+            mt_pingMainTH();  // more=true: nMsg_ > 0
+            break;
+        }
+        more = handleOneMsg_();  // false: no msg, or low pri (pinged already)
+    }
+    return nHandled;
+}
 
-        if (not nMsg())
-            return false;    // no more to continue
-        if (isLowPri(EMsgPriority(msgPri)))
+// ***********************************************************************************************
+size_t MsgSelf::handleNMsg(const size_t aMaxN) noexcept
+{
+    mergeIntake_();
+    advanceTimers_(std::chrono::steady_clock::now());
+    size_t nHandled = 0;
+    for (bool more = nMsg_ > 0; more; ++nHandled)
+    {
+        if (nHandled == aMaxN)
         {
             mt_pingMainTH();
-            return false;    // not continue for low priority until next ping-pong
+            break;
         }
-        return true;
+        more = handleOneMsg_();
+    }
+    return nHandled;
+}
+
+// ***********************************************************************************************
+bool MsgSelf::handleOneMsg_() noexcept
+{
+    EMsgPriority msgPri;
+    QueuedMsg queued;
+    bool promoted;
+    do
+    {
+        if (! nonEmpty_)
+            return false;  // only cancelled ones
+        const auto lowBits = nonEmpty_ & LOW_PRI_BITS;
+        promoted = lowBits && lowBits != nonEmpty_ && lowPriQuota_ && nNotLow_ >= lowPriQuota_;  // low waited enough
+        msgPri = EMsgPriority(63 - __builtin_clzll(promoted ? lowBits : nonEmpty_));  // highest non-empty
+        queued = popMsg_(msgPri);
+    } while (! queued.msg_);  // cancelled: drop w/o dispatch
+    --nMsg_;
+    if (isLowPri(msgPri))
+        nNotLow_ = 0;
+    else if (nonEmpty_ & LOW_PRI_BITS)
+        ++nNotLow_;  // only while low waits: a quiet period gives low no credit
+#if MSG_SELF_STATS
+    const auto startTick = queued.enqTick_ ? statTick() : 0;
+#endif
+
+    try { queued.msg_(); } // run 1st MsgCB; newMsgOK() prevent nullptr into msgQueues_
+    catch(...) { ERR("(MsgSelf) msg() except=" << mt_exceptInfo()); }
+#if MSG_SELF_STATS
+    if (startTick)
+    {
+        auto&& priStats = stats_.pri_[msgPri];
+        priStats.queue_.add(startTick > queued.enqTick_ ? startTick - queued.enqTick_ : 0);  // eg tsc skew across cores
+        priStats.run_.add(statTick() - startTick);
     }
-    return false;
+#endif
+
+    if (not nMsg())
+        return false;    // no more to continue
+    if (isLowPri(msgPri) && ! promoted)
+    {
+        mt_pingMainTH();
+        return false;    // not continue for low priority until next ping-pong
+    }
+    return true;         // promoted low: higher ones still wait, go on
+}
+
+// ***********************************************************************************************
+MsgSelf::QueuedMsg MsgSelf::popMsg_(const EMsgPriority aPri) noexcept
+{
+    auto&& priQ = msgQueues_[aPri];
+    QueuedMsg queued;
+    if (! priQ.resumed_.empty())
+        queued = priQ.resumed_.pop_front();
+    else
+    {
+        queued = priQ.fifo_.pop_front();
+        ++priQ.headSeq_;
+        if (! queued.msg_)
+            --priQ.nCancelled_;
+    }
+    if (priQ.empty())
+        nonEmpty_ &= ~(uint64_t(1) << aPri);
+    return queued;
 }
 
 // ***********************************************************************************************
-bool MsgSelf::newMsgOK(MsgCB aMsgCB, const EMsgPriority aMsgPri) noexcept
+bool MsgSelf::cancelMsgOK(const MsgToken aToken) noexcept
+{
+    const auto pri = EMsgPriority(aToken >> SEQ_BITS);
+    if (! isValidPri(pri))
+        return false;
+    auto&& priQ = msgQueues_[pri];
+    const auto idx = (aToken & ((MsgToken(1) << SEQ_BITS) - 1)) - priQ.headSeq_;  // wrap if handled
+    if (idx >= priQ.fifo_.size())
+        return false;
+    auto&& slot = priQ.fifo_[idx];
+    if (! slot.msg_)
+        return false;  // cancelled already
+
+    slot.msg_.reset();  // free captures now
+    ++priQ.nCancelled_;
+    --nMsg_;
+    return true;
+}
+
+// ***********************************************************************************************
+MsgTimer MsgSelf::newTimedMsg_(const std::chrono::milliseconds aDelay, MsgCB&& aMsgCB, const EMsgPriority aPri,
+    const bool aPeriodic) noexcept
+{
+    if (! aMsgCB || ! isValidPri(aPri) || aDelay.count() < (aPeriodic ? 1 : 0))
+    {
+        WRN("(MsgSelf) failed!!! null msg, outbound pri=" << aPri << " or invalid delay(ms)=" << aDelay.count());
+        return 0;
+    }
+
+    const auto id = ++lastTimer_;
+    auto&& timed = timedMsgs_[id];
+    timed.cb_       = std::move(aMsgCB);
+    timed.pri_      = aPri;
+    timed.periodMs_ = aPeriodic ? size_t(aDelay.count()) : 0;
+    timed.timer_    = armTimer(aDelay, [this, id]{ fireTimer_(id); });
+    return id;
+}
+
+// ***********************************************************************************************
+TimerHandle MsgSelf::armTimer(const std::chrono::milliseconds aDelay, MsgCB&& aCB) noexcept
+{
+    if (! aCB || aDelay.count() < 0)
+    {
+        WRN("(MsgSelf) failed!!! null cb or invalid delay(ms)=" << aDelay.count());
+        return 0;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (! wheel_)
+    {
+        wheel_ = std::make_unique<TimerWheel>(uniLogName(), 1, now);  // except eg bad_alloc: can't recover->terminate
+        wheelStart_ = now;
+    }
+    // - wheel's now is of last advance (handleXxx() skips it w/o timer): stale after idle/busy main loop
+    //   . no timer: advance() is an O(1) jump that can't call any cb, so catch up (nextCheck() exact too)
+    //   . else + lag so aDelay is from now; not advance(): may run due cb in usr's call
+    const auto nowMs = uint64_t(std::chrono::duration_cast<std::chrono::milliseconds>(now - wheelStart_).count());
+    if (wheel_->nTimer() == 0)
+    {
+        advanceToMs_ = nowMs;
+        wheel_->advance(now);
+    }
+    return wheel_->arm(nowMs - wheel_->nowTick() + size_t(aDelay.count()) + 1, std::move(aCB));  // +1: now is floor
+}
+
+// ***********************************************************************************************
+bool MsgSelf::disarmTimerOK(const TimerHandle aTimer) noexcept
+{
+    return wheel_ && wheel_->cancelOK(aTimer);
+}
+
+// ***********************************************************************************************
+bool MsgSelf::cancelTimerOK(const MsgTimer aTimer) noexcept
+{
+    const auto it = timedMsgs_.find(aTimer);
+    if (it == timedMsgs_.end())
+        return false;
+    wheel_->cancelOK(it->second.timer_);
+    timedMsgs_.erase(it);
+    return true;
+}
+
+// ***********************************************************************************************
+void MsgSelf::advanceTimers_(const std::chrono::steady_clock::time_point aNow) noexcept
+{
+    if (! wheel_ || wheel_->nTimer() == 0)
+        return;  // no clock math in common case
+    advanceToMs_ = std::chrono::duration_cast<std::chrono::milliseconds>(aNow - wheelStart_).count();
+    wheel_->advance(aNow);
+}
+
+// ***********************************************************************************************
+// - in wheel_->advance(): only queue the msg (usr cb runs later in handleOneMsg_, so no wheel re-entry)
+void MsgSelf::fireTimer_(const MsgTimer aTimer) noexcept
+{
+    const auto it = timedMsgs_.find(aTimer);  // always found: cancelTimerOK() cancels in wheel_ too
+    auto&& timed = it->second;
+    if (timed.periodMs_ == 0)
+    {
+        (void)pushMsgOK_(toMsg_(std::move(timed.cb_)), timed.pri_, false, true);
+        timedMsgs_.erase(it);
+        return;
+    }
+
+    (void)pushMsgOK_(toMsg_(MsgCB(timed.cb_)), timed.pri_, false, true);  // except eg bad_alloc: can't recover->terminate
+    const auto lagMs = advanceToMs_ - wheel_->nowTick();  // >0: main loop late, skip missed periods
+    timed.timer_ = wheel_->arm(timed.periodMs_ * (lagMs / timed.periodMs_ + 1), [this, aTimer]{ fireTimer_(aTimer); });
+}
+
+// ***********************************************************************************************
+void MsgSelf::timedwait(const size_t aSec, const size_t aRestNsec) noexcept
+{
+    const auto ns = waitNs(aSec * 1'000'000'000 + std::min(aRestNsec, size_t(999'999'999)));
+    rlib::timedwait(ns / 1'000'000'000, ns % 1'000'000'000);
+}
+
+// ***********************************************************************************************
+size_t MsgSelf::waitNs(const size_t aMaxNs) const noexcept
+{
+    if (! wheel_ || wheel_->nTimer() == 0)
+        return aMaxNs;
+    const auto dueNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        wheel_->nextCheck() - std::chrono::steady_clock::now()).count();
+    return std::min(aMaxNs, size_t(std::max<int64_t>(dueNs, 0)));
+}
+
+// ***********************************************************************************************
+void MsgSelf::mergeIntake_() noexcept
+{
+    IntakeMsg intake;
+    while (intake_.pop(intake))
+        (void)pushMsgOK_(std::move(intake.msg_), intake.pri_, false, false);  // validated in mt_newMsgOK()
+}
+
+// ***********************************************************************************************
+bool MsgSelf::pushMsgOK_(InlineMsg&& aMsg, const EMsgPriority aMsgPri, bool aFront, bool aPing) noexcept
 {
     // validate
-    if (! aMsgCB)
+    if (! aMsg)
     {
         WRN("(MsgSelf) failed!!! aMsgCB=nullptr doesn't make sense.");
         return false;
@@ -58,18 +285,64 @@ bool MsgSelf::newMsgOK(MsgCB aMsgCB, const EMsgPriority aMsgPri) noexcept
     }
 
     // store
+    QueuedMsg queued;
+    queued.msg_ = std::move(aMsg);
+#if MSG_SELF_STATS
+    if ((nEnq_++ & (MSG_SELF_STATS - 1)) == 0)
+        queued.enqTick_ = statTick();
+#endif
+    auto&& priQ = msgQueues_[aMsgPri];
     try {
-        msgQueues_[aMsgPri].emplace_back(std::move(aMsgCB));
+        if (aFront)
+            priQ.resumed_.push_front(std::move(queued));
+        else
+            priQ.fifo_.push_back(std::move(queued));
     } catch(...) {  // ut can't cover this branch; rare but safer
-        ERR("(MsgSelf) except=" << mt_exceptInfo() << " in newMsgOK");
+        ERR("(MsgSelf) except=" << mt_exceptInfo() << " in pushMsgOK_");
         return false;
     }
+    nonEmpty_ |= uint64_t(1) << aMsgPri;
     ++nMsg_;
+#if MSG_SELF_STATS
+    stats_.pri_[aMsgPri].maxDepth_ = std::max(stats_.pri_[aMsgPri].maxDepth_, priQ.nLive());
+#endif
     HID("(MsgSelf) nMsg=" << nMsg_);
 
-    // ping main thread
-    mt_pingMainTH();
+    // ping main thread; no need if resume/merge (in handleAllMsg() already)
+    if (aPing)
+        mt_pingMainTH();
     return true;
 }
 
+// ***********************************************************************************************
+bool MsgSelf::shallYield(const EMsgPriority aPri) const noexcept
+{
+    return isLowPri(aPri) || (isValidPri(aPri) && (nonEmpty_ >> aPri) > 1);  // any higher bit
+}
+
+// ***********************************************************************************************
+void MsgSelf::resetStats() noexcept
+{
+#if MSG_SELF_STATS
+    stats_     = MsgSelfStats();
+    nEnq_      = 0;
+    startTime_ = std::chrono::steady_clock::now();
+    startTick_ = statTick();
+#endif
+}
+
+#if MSG_SELF_STATS
+// ***********************************************************************************************
+MsgSelfStats MsgSelf::stats() const noexcept
+{
+    auto snapshot = stats_;
+    const auto nTick = statTick() - startTick_;
+    const auto nNs   = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime_).count();
+    if (nTick > 0 && nNs > 0)
+        snapshot.nsPerTick_ = double(nNs) / double(nTick);
+    return snapshot;
+}
+#endif
+
 }  // namespace
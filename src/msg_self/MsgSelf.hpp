@@ -11,14 +11,22 @@
 //   . can withdraw on-road MsgCB (eg HdlrDomino.rmHdlr())
 //
 // - how:
-//   . newMsgOK(): send msgHdlr into msgQueues_ (all info are in msgHdlr so func<void()> is enough)
+//   . newMsgOK(): send msgHdlr into msgQueues_ (all info are in msgHdlr so void() callable is enough)
+//   . newCancelableMsg(): + token=[pri][seq] to cancelMsgOK() in O(1); cancelled = empty slot skipped at pop
 //   . handleAllMsg(): call all msgHdlr in msgQueues_, priority then FIFO
+//   . handleNMsg()/handleMsgFor(): same but stop at a budget, so a burst can't block main loop
 //   . single thread (in main thread)
+//   . mt_newMsgOK(): any thread -> lock-free intake_, merged into msgQueues_ at each handleXxx() start
+//   . newMsgAfterOK()/newPeriodicMsg(): in wheel_ (TimerWheel) till due, then as newMsgOK();
+//     due ones checked at each handleXxx() start; this->timedwait() wakes up by next due
+//   . armTimer(): raw cb in the same wheel_ (eg DeadlineDom), so 1 wheel driven & waited by main loop
 //   * support diff cb mechanism (async, IM, syscom, etc)
 //
 // - core: msgQueues_[priority][FIFO]
-//   . msgQueues_ is a 2D array, 1st dim is priority, 2nd dim is FIFO
+//   . msgQueues_ is a 2D array, 1st dim is priority, 2nd dim is FIFO (+ resumed_ before it)
 //   . perf better than priority_queue that need search & insert for newMsgOK()
+//   . nonEmpty_ bit[pri]: highest non-empty queue by 1 clz, not scan all levels
+//   . setLowPriQuota(): optional deficit count so low pri can't starve forever
 //
 // - which way?    speed                   UT                           code
 //   . async task  may slow if async busy  no but direct-CB instead     simple
@@ -27,7 +35,12 @@
 //   . (conclusion: async for product, direct-CB for UT)
 // - why MsgCB instead of WeakMsgCB in msgQueues_?
 //   . most users want MsgSelf (instead of themselves) to store cb (naturally; so MsgCB is better)
-//   . while only a few want to be able to withdraw cb in msgQueues_ (eg HdlrDomino; so WeakMsgCB is better)
+//   . while only a few want to be able to withdraw cb in msgQueues_ (eg HdlrDomino; so WeakMsgCB or HdlrSlab handle;
+//     or newCancelableMsg() token: no shared_ptr at all)
+// - why cancelled msg left as an empty slot, not removed from ring at once?
+//   . token -> slot is "seq - headSeq_" only while fifo_ never shifts; empty slot freed at pop (O(1) each)
+//
+// - MSG_SELF_STATS: 3 statTick() (enqueue, start, end) + 2 hist add per sampled msg
 //
 // - class safe: yes
 //   . not responsible for MsgCB itself's any unsafe behavior
@@ -41,25 +54,49 @@
 #pragma once
 
 #include <array>
-#include <deque>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
 
+#include "InlineFn.hpp"
+#include "LatencyHist.hpp"
+#include "MpscQ.hpp"
 #include "MT_PingMainTH.hpp"
+#include "RingQ.hpp"
 #include "UniLog.hpp"
 #include "UniPtr.hpp"
 
 #define MSG_SELF (ObjAnywhere::getObj<MsgSelf>())
 
+#ifndef MSG_INLINE_SZ
+#define MSG_INLINE_SZ 56  // msg callable up to this size w/o heap; 56 -> 64B per queued msg
+#endif
+
 namespace rlib
 {
 // ***********************************************************************************************
+// - levels by build flag (eg -DMSG_PRI_N=6 -DMSG_PRI_N_LOW=2 for abort>alarm>control>norm>bulk>background)
+//   . [0, NORM): low pri (1 msg/round); NORM = MSG_PRI_N_LOW; HIGH = top; between: EMsgPriority(NORM + k)
+//   . default 3 levels = LOW/NORM/HIGH as before
+#ifndef MSG_PRI_N
+#define MSG_PRI_N 3
+#endif
+#ifndef MSG_PRI_N_LOW
+#define MSG_PRI_N_LOW 1
+#endif
+static_assert(MSG_PRI_N <= 64, "REQ: 1 bit/pri in MsgSelf::nonEmpty_");
+static_assert(MSG_PRI_N_LOW >= 1 && MSG_PRI_N_LOW + 2 <= MSG_PRI_N, "REQ: LOW < NORM < HIGH");
+
 enum EMsgPriority : unsigned char
 {
     EMsgPri_MIN,
 
-    EMsgPri_LOW = EMsgPri_MIN,
-    EMsgPri_NORM,
-    EMsgPri_HIGH,
+    EMsgPri_LOW  = EMsgPri_MIN,
+    EMsgPri_NORM = MSG_PRI_N_LOW,
+    EMsgPri_HIGH = MSG_PRI_N - 1,
 
     EMsgPri_MAX
 };
@@ -70,34 +107,206 @@ enum EMsgPriority : unsigned char
 using MsgCB        = std::function<void()>;
 using WeakMsgCB    = W_PTR<MsgCB>;
 using SharedMsgCB  = S_PTR<MsgCB>;
+using InlineMsg    = InlineFn<MSG_INLINE_SZ>;  // in msgQueues_: lambda directly, not via MsgCB
+using MsgToken     = uint64_t;  // [pri:8][seq:56]; seq never reused so no generation needed; 0=invalid
+using MsgTimer     = uint64_t;  // newPeriodicMsg() id; 0=invalid
+using TimerHandle  = uint64_t;  // armTimer() & TimerWheel: [gen:32][idx:32]; 0=null (gen starts from 1)
+class TimerWheel;
+
+#if MSG_SELF_STATS  // REQ: same flag for lib & usr (class layout)
+static_assert((MSG_SELF_STATS & (MSG_SELF_STATS - 1)) == 0, "REQ: sample 1 per 2^n msg");
+
+// ***********************************************************************************************
+// - unit of hist is statTick(); ns() converts by ratio calibrated over the stats period
+// - hist of 1 per MSG_SELF_STATS msg (sampled); maxDepth_ of all
+struct MsgPriStats
+{
+    LatencyHist queue_;  // newMsgOK() -> dispatch
+    LatencyHist run_;    // handler runtime
+    size_t maxDepth_ = 0;
+};
+struct MsgSelfStats
+{
+    std::array<MsgPriStats, EMsgPri_MAX> pri_;
+    double nsPerTick_ = 1;
+
+    [[nodiscard]] uint64_t ns(const uint64_t aTick) const noexcept { return uint64_t(double(aTick) * nsPerTick_); }
+};
+#endif
 
 // ***********************************************************************************************
 class MsgSelf : public UniLog
 {
 public:
-    explicit MsgSelf(const LogName& aUniLogName = ULN_DEFAULT) noexcept : UniLog(aUniLogName) {}
-    ~MsgSelf() noexcept { if (nMsg_) WRN("discard nMsg=" << nMsg_); }
+    explicit MsgSelf(const LogName& aUniLogName = ULN_DEFAULT) noexcept;
+    ~MsgSelf() noexcept;
 
     MsgSelf(const MsgSelf&)            = delete;
     MsgSelf& operator=(const MsgSelf&) = delete;
     MsgSelf(MsgSelf&&)                 = delete;
     MsgSelf& operator=(MsgSelf&&)      = delete;
 
-    [[nodiscard]] bool   newMsgOK(MsgCB, const EMsgPriority = EMsgPri_NORM) noexcept;
+    // - any void() callable (lambda/MsgCB/fn ptr); lambda <= MSG_INLINE_SZ: no heap at all
+    template<class aMsg> [[nodiscard]] bool newMsgOK(aMsg&& aMsgCB, const EMsgPriority aPri = EMsgPri_NORM) noexcept
+        { return pushMsgOK_(toMsg_(std::forward<aMsg>(aMsgCB)), aPri, false, true); }
+    // - any thread (eg worker -> main w/o MtInQueue/ThreadBack): 1 node alloc + 1 atomic xchg + ping
+    // - as newMsgOK() once merged; not in nMsg() till then; REQ: MsgSelf outlives all callers
+    template<class aMsg> [[nodiscard]] bool mt_newMsgOK(aMsg&& aMsgCB, const EMsgPriority aPri = EMsgPri_NORM) noexcept;
+    // - as newMsgOK() + ret token (0=failed) to withdraw the msg by cancelMsgOK() in O(1)
+    //   . cancelled: captures freed at once; not in nMsg(); slot dropped at pop w/o dispatch
+    //   . than SharedMsgCB dying: no per-msg shared_ptr, dead msg costs no dispatch
+    template<class aMsg> [[nodiscard]] MsgToken newCancelableMsg(aMsg&& aMsgCB, const EMsgPriority aPri = EMsgPri_NORM) noexcept
+    {
+        if (! pushMsgOK_(toMsg_(std::forward<aMsg>(aMsgCB)), aPri, false, true))
+            return 0;
+        auto&& priQ = msgQueues_[aPri];
+        return (MsgToken(aPri) << SEQ_BITS) | (priQ.headSeq_ + priQ.fifo_.size() - 1);
+    }
+    bool cancelMsgOK(const MsgToken) noexcept;  // false: handled/cancelled/invalid
+    // - for a batch msg (eg HdlrDomino's hdlrs of 1 wave) to behave as its items were separate msgs:
+    //   . shallYield(): after 1 item, any higher pri msg to run 1st? (low pri: always 1 item/round)
+    //   . resumeMsgOK(): rest items back to queue front, before same-pri msgs (no ping: in handleAllMsg())
+    [[nodiscard]] bool   shallYield(const EMsgPriority aPri) const noexcept;
+    template<class aMsg> [[nodiscard]] bool resumeMsgOK(aMsg&& aMsgCB, const EMsgPriority aPri) noexcept
+        { return pushMsgOK_(toMsg_(std::forward<aMsg>(aMsgCB)), aPri, true, false); }
+    // - timed msg (eg "retry in 500ms", "poll every 1s") in main thread: ~100B each, not a thread
+    //   . due after >= aDelay (1ms tick), then queued as newMsgOK(); REQ: main loop waits by this->timedwait()
+    //   . periodic: missed periods (eg main loop blocked) skipped, not burst; stop by cancelTimerOK()
+    [[nodiscard]] bool newMsgAfterOK(const std::chrono::milliseconds aDelay, MsgCB aMsgCB, const EMsgPriority aPri = EMsgPri_NORM) noexcept
+        { return newTimedMsg_(aDelay, std::move(aMsgCB), aPri, false) != 0; }
+    [[nodiscard]] MsgTimer newPeriodicMsg(const std::chrono::milliseconds aPeriod, MsgCB aMsgCB, const EMsgPriority aPri = EMsgPri_NORM) noexcept
+        { return newTimedMsg_(aPeriod, std::move(aMsgCB), aPri, true); }
+    bool cancelTimerOK(const MsgTimer) noexcept;  // false: invalid/cancelled
+    [[nodiscard]] size_t nTimer() const noexcept { return timedMsgs_.size(); }  // timed msg# (not armTimer)
+    // - raw timer in the same wheel: aCB runs in handleXxx()'s wheel advance (before msgs), not queued
+    //   . so disarmTimerOK() is exact till aCB runs (eg DeadlineDom cancels on time); 0=failed
+    //   . aCB shall not handleXxx() nor destroy MsgSelf (wheel re-entry)
+    [[nodiscard]] TimerHandle armTimer(const std::chrono::milliseconds aDelay, MsgCB&& aCB) noexcept;
+    bool disarmTimerOK(const TimerHandle aTimer) noexcept;  // false: fired/disarmed/invalid
+    // - as rlib::timedwait() but return at next timed msg's (or armTimer's) due at latest
+    void timedwait(const size_t aSec = 0, const size_t aRestNsec = 100'000'000) noexcept;
+    [[nodiscard]] size_t waitNs(const size_t aMaxNs) const noexcept;  // min(aMaxNs, to next due): eg for EpollLoop
+
+    // - anti-starvation: while low pri msg waits, 1 low per aNHigher non-low msgs (deficit count)
+    //   . 0 (default): strict priority, low only when no higher (may starve under sustained load)
+    //   . batch msg (eg HdlrDomino's wave) counts 1
+    void setLowPriQuota(const size_t aNHigher) noexcept { lowPriQuota_ = aNHigher; nNotLow_ = 0; }
+
     [[nodiscard]] size_t nMsg() const noexcept { return nMsg_; }
-    [[nodiscard]] size_t nMsg(const EMsgPriority aPri) const noexcept { return isValidPri(aPri) ? msgQueues_[aPri].size() : 0; }
+    [[nodiscard]] size_t nMsg(const EMsgPriority aPri) const noexcept { return isValidPri(aPri) ? msgQueues_[aPri].nLive() : 0; }
     void handleAllMsg() noexcept;
+    // - as handleAllMsg() but stop at budget (still priority then FIFO); rest msg -> mt_pingMainTH()
+    //   so next timedwait() returns at once; ret handled#
+    // - a new high pri msg waits at most the budget (or 1 msg), not the whole burst
+    // - 1 batch msg (eg HdlrDomino's wave) counts 1: it yields to higher pri itself (shallYield)
+    size_t handleNMsg(const size_t aMaxN) noexcept;
+    size_t handleMsgFor(const std::chrono::nanoseconds aBudget) noexcept;  // >= 1 msg: always progress
+
+    // - opt-in by -DMSG_SELF_STATS=<sample 1 per N msg>: queueing delay, runtime & max depth per pri
+    //   . else (default) 0 overhead
+#if MSG_SELF_STATS
+    [[nodiscard]] MsgSelfStats stats() const noexcept;  // snapshot since ctor/resetStats()
+#endif
+    void resetStats() noexcept;
 
     [[nodiscard]] static constexpr bool isLowPri(const EMsgPriority aPri) noexcept { return aPri < EMsgPri_NORM; }
     [[nodiscard]] static constexpr bool isValidPri(const EMsgPriority aPri) noexcept { return aPri < EMsgPri_MAX; }
 
 private:
     bool handleOneMsg_() noexcept;
+    struct QueuedMsg;
+    QueuedMsg popMsg_(const EMsgPriority) noexcept;  // may be cancelled (empty)
+    bool pushMsgOK_(InlineMsg&&, const EMsgPriority, bool aFront, bool aPing) noexcept;
+    void mergeIntake_() noexcept;
+    MsgTimer newTimedMsg_(const std::chrono::milliseconds, MsgCB&&, const EMsgPriority, const bool aPeriodic) noexcept;
+    void advanceTimers_(const std::chrono::steady_clock::time_point) noexcept;
+    void fireTimer_(const MsgTimer) noexcept;
+
+    // - null (nullptr/empty MsgCB/null fn ptr) or bad_alloc -> empty InlineMsg (pushMsgOK_ refuses)
+    template<class aMsg> static InlineMsg toMsg_(aMsg&& aMsgCB) noexcept
+    {
+        using Msg = std::decay_t<aMsg>;
+        if constexpr (std::is_null_pointer_v<Msg>)
+            return {};
+        else
+        {
+            if constexpr (std::is_same_v<Msg, MsgCB> || std::is_pointer_v<Msg>)
+                if (! aMsgCB)
+                    return {};
+            try { return InlineMsg(std::forward<aMsg>(aMsgCB)); }
+            catch(...) { return {}; }  // ut can't cover this branch; rare but safer
+        }
+    }
 
     // -------------------------------------------------------------------------------------------
-    std::array<std::deque<MsgCB>, EMsgPri_MAX> msgQueues_;
+    struct QueuedMsg
+    {
+        InlineMsg msg_;
+#if MSG_SELF_STATS
+        uint64_t enqTick_ = 0;  // 0: not sampled
+#endif
+    };
+    struct PriQ
+    {
+        RingQ<QueuedMsg> resumed_;  // by resumeMsgOK(): before fifo_; separate so fifo_ is push_back only
+        RingQ<QueuedMsg> fifo_;     // [i] seq = headSeq_ + i
+        uint64_t headSeq_   = 1;    // token seq starts from 1: token never 0
+        size_t   nCancelled_ = 0;   // empty slots in fifo_
+
+        [[nodiscard]] bool   empty() const noexcept { return resumed_.empty() && fifo_.empty(); }
+        [[nodiscard]] size_t nLive() const noexcept { return resumed_.size() + fifo_.size() - nCancelled_; }
+    };
+    static constexpr size_t SEQ_BITS = 56;
+    std::array<PriQ, EMsgPri_MAX> msgQueues_;
+    uint64_t nonEmpty_ = 0;  // bit[pri] = ! msgQueues_[pri].empty()
     size_t nMsg_ = 0;
+    static constexpr uint64_t LOW_PRI_BITS = (uint64_t(1) << EMsgPri_NORM) - 1;
+    size_t lowPriQuota_ = 0;  // setLowPriQuota()
+    size_t nNotLow_     = 0;  // non-low msgs handled since last low one, while low waits
+
+    struct IntakeMsg
+    {
+        InlineMsg    msg_;
+        EMsgPriority pri_ = EMsgPri_NORM;
+    };
+    MpscQ<IntakeMsg> intake_;  // from mt_newMsgOK()
+
+    struct TimedMsg
+    {
+        MsgCB        cb_;
+        EMsgPriority pri_      = EMsgPri_NORM;
+        size_t       periodMs_ = 0;  // 0: once
+        TimerHandle  timer_    = 0;  // in wheel_
+    };
+    std::unique_ptr<TimerWheel> wheel_;  // at 1st timed msg/armTimer(): nothing if never used
+    std::unordered_map<MsgTimer, TimedMsg> timedMsgs_;
+    MsgTimer lastTimer_ = 0;
+    std::chrono::steady_clock::time_point wheelStart_;
+    uint64_t advanceToMs_ = 0;  // of wheel_'s current advance(): to skip missed periods
+
+#if MSG_SELF_STATS
+    MsgSelfStats stats_;
+    size_t   nEnq_      = 0;  // for sampling
+    uint64_t startTick_ = 0;  // resetStats(): calibrate tick to ns w/ startTime_
+    std::chrono::steady_clock::time_point startTime_;
+#endif
 };
+
+// ***********************************************************************************************
+template<class aMsg>
+bool MsgSelf::mt_newMsgOK(aMsg&& aMsgCB, const EMsgPriority aPri) noexcept
+{
+    if (! isValidPri(aPri)
+        || ! intake_.mt_emplaceOK([](const IntakeMsg& aIntake) noexcept { return bool(aIntake.msg_); },
+            toMsg_(std::forward<aMsg>(aMsgCB)), aPri))  // in node directly: no move
+    {
+        HID("(MsgSelf) failed!!! null msg or outbound pri=" << aPri);  // HID supports MT (ERR/WRN don't)
+        return false;
+    }
+    mt_pingMainTH();
+    return true;
+}
+
 }  // namespace
 // ***********************************************************************************************
 // YYYY-MM-DD  Who       v)Modification Description
@@ -121,4 +330,25 @@ private:
 // 2023-10-27  CSZ       - replace pingMainFN_() by mt_pingMainTH()
 // 2025-02-13  CSZ       - support both SafePtr & shared_ptr
 // 2025-03-25  CSZ       5)enable exception: tolerate is safer; can't recover except->terminate
+// 2026-10-18  CSZ       - shallYield() & resumeMsgOK() for batch msg
+//                       - RingQ<InlineMsg> than deque<MsgCB>: common msg never touches heap
+//                       - handleNMsg() & handleMsgFor(): bound main-loop latency
+//                       - MSG_PRI_N levels & nonEmpty_ bitmap
+//                       - MSG_SELF_STATS: latency histograms per priority
+//                       - mt_newMsgOK(): lock-free MPSC intake from any thread
+//                       - newCancelableMsg() & cancelMsgOK(): O(1) withdraw
+//                       - newMsgAfterOK() & newPeriodicMsg(): timer msg w/o thread
+//                       - setLowPriQuota(): low pri anti-starvation
+// 2026-10-19  CSZ       - armTimer(): 1 wheel for timed msg & DeadlineDom
 // ***********************************************************************************************
+// - why timer in wheel_ than each usr's thread/AsyncBack sleep?
+//   . thread = 8MB stack (see AsyncBack::MAX_ASYNC) & cb in other thread; wheel node + map node ~100B
+// - why armTimer() in MsgSelf than a TimerWheel in ObjAnywhere?
+//   . 2 wheels = 2 to advance & wait; main loop already drives MsgSelf, so the rest just works
+// - why armTimer() adds the wheel's lag than always advance() it?
+//   . advance() may run due cb (eg DeadlineDom's setState) inside usr's arm call; only safe w/o timer
+// - why periodic skips missed periods?
+//   . main loop blocked 10s w/ 1ms period would burst 10K msgs; usr wants "every", not "exactly N"
+// - why deficit count than promote low msg after T ms (aging)?
+//   . count is 2 ops per msg; age needs a clock read per msg (~35ns, more than the msg itself)
+//   . bounded by count: low waits <= quota x (higher msg runtime), so T follows from usr's quota
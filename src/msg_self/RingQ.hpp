@@ -0,0 +1,71 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: growable ring (deque-like push/pop at both ends) of move-only T, 1 contiguous buffer
+// - why: std::deque allocs/frees a chunk per ~512B of ele; MsgSelf's queue churns all the time
+// - how:
+//   . capacity 2^n (index by mask); full -> double & move all (amortized O(1)); never shrink
+//   . slot outside [head, head+size) is a default T (eg empty InlineFn): moved-out, no resrc
+//
+// - MT safe: no
+// ***********************************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace rlib
+{
+// ***********************************************************************************************
+template<class T>
+class RingQ
+{
+public:
+    [[nodiscard]] bool   empty()    const noexcept { return size_ == 0; }
+    [[nodiscard]] size_t size()     const noexcept { return size_; }
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+    void push_back (T&& aEle) { growIfFull_(); slots_[(head_ + size_) & mask_] = std::move(aEle); ++size_; }
+    void push_front(T&& aEle) { growIfFull_(); head_ = (head_ - 1) & mask_; slots_[head_] = std::move(aEle); ++size_; }
+    T& operator[](const size_t aIdx) noexcept { return slots_[(head_ + aIdx) & mask_]; }  // from front; REQ: < size()
+    T pop_front() noexcept  // REQ: ! empty()
+    {
+        T ele(std::move(slots_[head_]));
+        head_ = (head_ + 1) & mask_;
+        --size_;
+        return ele;
+    }
+
+private:
+    void growIfFull_()  // except eg bad_alloc: ring unchanged
+    {
+        if (size_ < capacity() && slots_)
+            return;
+        const size_t newCap = slots_ ? 2 * capacity() : INIT_CAPACITY;
+        auto newSlots = std::make_unique<T[]>(newCap);
+        for (size_t i = 0; i < size_; ++i)
+            newSlots[i] = std::move(slots_[(head_ + i) & mask_]);
+        slots_ = std::move(newSlots);
+        mask_  = newCap - 1;
+        head_  = 0;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    static constexpr size_t INIT_CAPACITY = 16;
+    std::unique_ptr<T[]> slots_;
+    size_t mask_ = 0;  // capacity() = 1 before 1st push: empty() & no alloc
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+//                       - operator[] for MsgSelf's cancel
+// ***********************************************************************************************
@@ -0,0 +1,223 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+
+#include "TimerWheel.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+TimerWheel::TimerWheel(const LogName& aUniLogName, size_t aTickMs, Clock::time_point aStart) noexcept
+    : UniLog(aUniLogName)
+    , start_(aStart)
+    , tickMs_(max<size_t>(aTickMs, 1))
+{
+    for (auto&& level : head_)
+        level.fill(NIL);
+}
+
+// ***********************************************************************************************
+TimerHandle TimerWheel::arm(size_t aMs, MsgCB&& aCB) noexcept
+{
+    if (! aCB)
+    {
+        WRN("(TimerWheel) Failed!!! not accept cb=nullptr");
+        return 0;
+    }
+
+    uint32_t idx = freeHead_;
+    if (idx == NIL)
+    {
+        idx = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();  // except eg bad_alloc: can't recover->terminate
+    }
+    else
+        freeHead_ = nodes_[idx].next_;
+
+    const uint64_t nTick = clamp<uint64_t>((aMs + tickMs_ - 1) / tickMs_, 1, UINT32_MAX);
+    auto&& node = nodes_[idx];
+    node.cb_     = move(aCB);
+    node.expire_ = now_ + nTick;
+    link_(idx);
+    ++nTimer_;
+    return (TimerHandle(node.gen_) << 32) | idx;
+}
+
+// ***********************************************************************************************
+void TimerWheel::link_(uint32_t aIdx) noexcept
+{
+    auto&& node = nodes_[aIdx];
+    const auto diff = node.expire_ ^ now_;
+    uint8_t level = 0;
+    while (size_t(level) + 1 < N_LEVEL && diff >= (uint64_t(1) << (N_BIT * (level + 1))))
+        ++level;
+    const auto slot = (node.expire_ >> (N_BIT * level)) & MASK;
+
+    auto&& head = head_[level][slot];
+    node.level_ = level;
+    node.prev_  = NIL;
+    node.next_  = head;
+    if (head != NIL)
+        nodes_[head].prev_ = aIdx;
+    head = aIdx;
+    if (level == 0)
+        occupied0_[slot / 64] |= uint64_t(1) << (slot % 64);
+}
+
+// ***********************************************************************************************
+void TimerWheel::unlink_(uint32_t aIdx) noexcept
+{
+    auto&& node = nodes_[aIdx];
+    const auto slot = (node.expire_ >> (N_BIT * node.level_)) & MASK;
+    auto&& head = head_[node.level_][slot];
+    if (node.prev_ != NIL)
+        nodes_[node.prev_].next_ = node.next_;
+    else
+        head = node.next_;
+    if (node.next_ != NIL)
+        nodes_[node.next_].prev_ = node.prev_;
+    if (node.level_ == 0 && head == NIL)
+        occupied0_[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+}
+
+// ***********************************************************************************************
+void TimerWheel::free_(uint32_t aIdx) noexcept
+{
+    auto&& node = nodes_[aIdx];
+    MsgCB rmCB;  // release captured resrc at return: its destructor may re-enter wheel
+    rmCB.swap(node.cb_);
+    if (++node.gen_ == 0)
+        node.gen_ = 1;  // 0 is null handle
+    node.next_ = freeHead_;
+    freeHead_  = aIdx;
+    --nTimer_;
+}
+
+// ***********************************************************************************************
+bool TimerWheel::cancelOK(TimerHandle aTimer) noexcept
+{
+    if (! isArmed(aTimer))
+        return false;
+
+    const auto idx = idx_(aTimer);
+    if (nodes_[idx].level_ != DETACHED)
+        unlink_(idx);
+    free_(idx);
+    return true;
+}
+
+// ***********************************************************************************************
+size_t TimerWheel::nextOccupied_(size_t aFrom) const noexcept
+{
+    for (size_t w = aFrom / 64; w < occupied0_.size(); ++w)
+    {
+        auto bits = occupied0_[w];
+        if (w == aFrom / 64)
+            bits &= ~uint64_t(0) << (aFrom % 64);
+        if (bits)
+            return w * 64 + __builtin_ctzll(bits);
+    }
+    return N_SLOT;
+}
+
+// ***********************************************************************************************
+TimerWheel::Clock::time_point TimerWheel::nextCheck() const noexcept
+{
+    if (nTimer_ == 0)
+        return Clock::time_point::max();
+    const auto next = (now_ & ~MASK) + nextOccupied_((now_ & MASK) + 1);  // N_SLOT: level-0 wrap
+    return start_ + chrono::milliseconds(next * tickMs_);
+}
+
+// ***********************************************************************************************
+// - top level 1st: its timers may land in a lower level's slot that cascades right after
+void TimerWheel::cascade_() noexcept
+{
+    size_t topLevel = 1;
+    while (topLevel + 1 < N_LEVEL && ((now_ >> (N_BIT * topLevel)) & MASK) == 0)
+        ++topLevel;
+
+    for (auto level = topLevel; level >= 1; --level)
+    {
+        auto&& head = head_[level][(now_ >> (N_BIT * level)) & MASK];
+        auto idx = head;
+        head = NIL;  // detach: relink may put timer back to this slot (far future)
+        while (idx != NIL)
+        {
+            const auto next = nodes_[idx].next_;
+            link_(idx);
+            idx = next;
+        }
+    }
+}
+
+// ***********************************************************************************************
+size_t TimerWheel::expire_(size_t aSlot) noexcept
+{
+    vector<TimerHandle> expiring;
+    expiring.swap(expiring_);  // reuse capacity
+
+    auto&& head = head_[0][aSlot];
+    for (auto idx = head; idx != NIL; idx = nodes_[idx].next_)
+    {
+        nodes_[idx].level_ = DETACHED;  // cb may cancel a later one
+        expiring.push_back((TimerHandle(nodes_[idx].gen_) << 32) | idx);
+    }
+    head = NIL;
+    occupied0_[aSlot / 64] &= ~(uint64_t(1) << (aSlot % 64));
+
+    size_t nExpired = 0;
+    for (auto&& timer : expiring)
+    {
+        if (! isArmed(timer))
+            continue;  // cancelled by prev cb
+        MsgCB cb;
+        cb.swap(nodes_[idx_(timer)].cb_);
+        free_(idx_(timer));  // before cb: cb may re-arm (nodes_ realloc)
+        ++nExpired;
+        try { cb(); }
+        catch(...) { ERR("(TimerWheel) cb() except=" << mt_exceptInfo()); }
+    }
+    expiring.clear();
+    expiring_.swap(expiring);
+    return nExpired;
+}
+
+// ***********************************************************************************************
+size_t TimerWheel::advance(Clock::time_point aNow) noexcept
+{
+    if (aNow <= start_)
+        return 0;
+    const uint64_t target = chrono::duration_cast<chrono::milliseconds>(aNow - start_).count() / tickMs_;
+
+    size_t nExpired = 0;
+    while (now_ < target)
+    {
+        if (nTimer_ == 0)
+        {
+            now_ = target;
+            break;
+        }
+        // next tick to visit: next occupied level-0 slot, or level-0 wrap (cascade)
+        const auto slot = nextOccupied_((now_ & MASK) + 1);
+        const auto next = (now_ & ~MASK) + slot;
+        if (next > target)
+        {
+            now_ = target;
+            break;
+        }
+        now_ = next;
+        if ((now_ & MASK) == 0)
+            cascade_();
+        nExpired += expire_(now_ & MASK);
+    }
+    return nExpired;
+}
+
+}  // namespace
@@ -0,0 +1,117 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - ISSUE:
+//   . nearly every upgrade step needs a timeout ("X not done within 30s") = 1 timer per tile
+//   . 1 OS/ext timer per tile: syscall/thread per timer, cb in other thread
+//
+// - how: hierarchical timing wheel (as Linux kernel timer), in main thread
+//   . 4 levels x 256 slots x tick (default 1ms) = 2^32 ticks (~49 days at 1ms)
+//   . timer in slot of the highest bit group where expire & now differ: cascade down when lower
+//     level wraps, so each timer moves <= 3 times in its life
+//   . arm/cancel: O(1) (intrusive list in dense nodes_ + free list; handle = [gen:32][idx:32])
+//   . advance(): O(expired + cascaded); empty level-0 slots skipped by occupied bitmap
+//   . owned & driven by MsgSelf (1 wheel per main loop): advance() at each handleXxx() start,
+//     nextCheck() bounds MSG_SELF->timedwait()/waitNs(); usr arms by MSG_SELF->armTimer()
+//     so precision = max(tick, main loop cadence)
+//
+// - core: nodes_, head_
+// - MT safe: no (main thread as MsgSelf)
+// - mem safe: yes; cb shall not destroy the wheel nor advance() it (re-entry)
+// ***********************************************************************************************
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "MsgSelf.hpp"
+
+namespace rlib
+{
+// ***********************************************************************************************
+class TimerWheel : public UniLog
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // @param aTickMs: resolution; 0 -> 1
+    explicit TimerWheel(const LogName& = ULN_DEFAULT, size_t aTickMs = 1, Clock::time_point aStart = Clock::now()) noexcept;
+
+    TimerWheel(const TimerWheel&)            = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // - aCB in advance() that passes now + aMs (rounded up to tick); aMs=0 -> next tick
+    [[nodiscard]] TimerHandle arm(size_t aMs, MsgCB&& aCB) noexcept;
+    bool cancelOK(TimerHandle) noexcept;  // false if expired/cancelled
+    [[nodiscard]] bool isArmed(TimerHandle aTimer) const noexcept
+        { return idx_(aTimer) < nodes_.size() && nodes_[idx_(aTimer)].gen_ == gen_(aTimer); }
+
+    // - call all expired cb (in expire order) up to aNow; ret expired#
+    size_t advance(Clock::time_point aNow = Clock::now()) noexcept;
+
+    // - earliest time advance() may expire any: exact if due in this level-0 round, else the next
+    //   cascade (early wakeup, harmless); time_point::max() if no timer
+    [[nodiscard]] Clock::time_point nextCheck() const noexcept;
+
+    [[nodiscard]] size_t   nTimer() const noexcept { return nTimer_; }
+    [[nodiscard]] uint64_t nowTick() const noexcept { return now_; }
+
+private:
+    static constexpr size_t   N_LEVEL = 4;
+    static constexpr size_t   N_BIT   = 8;
+    static constexpr size_t   N_SLOT  = 1 << N_BIT;
+    static constexpr uint64_t MASK    = N_SLOT - 1;
+    static constexpr uint32_t NIL     = UINT32_MAX;
+    static constexpr uint8_t  DETACHED = UINT8_MAX;  // in expiring_
+
+    static uint32_t idx_(TimerHandle aTimer) noexcept { return static_cast<uint32_t>(aTimer); }
+    static uint32_t gen_(TimerHandle aTimer) noexcept { return static_cast<uint32_t>(aTimer >> 32); }
+
+    void link_(uint32_t aIdx) noexcept;    // into slot by expire_
+    void unlink_(uint32_t aIdx) noexcept;  // from its slot
+    void free_(uint32_t aIdx) noexcept;
+    void cascade_() noexcept;              // at level-0 wrap
+    size_t expire_(size_t aSlot) noexcept;
+    size_t nextOccupied_(size_t aFrom) const noexcept;  // level-0 slot >= aFrom, or N_SLOT
+
+    // -------------------------------------------------------------------------------------------
+    struct Node
+    {
+        MsgCB    cb_;
+        uint64_t expire_ = 0;  // tick
+        uint32_t prev_   = NIL;
+        uint32_t next_   = NIL;  // in free list: next free
+        uint32_t gen_    = 1;
+        uint8_t  level_  = 0;
+    };
+    std::vector<Node> nodes_;
+    uint32_t freeHead_ = NIL;
+    std::array<std::array<uint32_t, N_SLOT>, N_LEVEL> head_;  // [level][slot]=1st node; NIL=empty
+    std::array<uint64_t, N_SLOT / 64> occupied0_ = {};        // bit[slot] of level 0
+    std::vector<TimerHandle> expiring_;  // reuse: no alloc per advance()
+
+    const Clock::time_point start_;
+    const size_t tickMs_;
+    uint64_t now_    = 0;  // tick
+    size_t   nTimer_ = 0;
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-18  CSZ       1)create
+//                       - nextCheck() for main loop's wait timeout
+// 2026-10-19  CSZ       - owned by MsgSelf than TIMER_WHEEL: 1 wheel to advance & wait
+// ***********************************************************************************************
+// - why not priority_queue (heap)?
+//   . arm/cancel O(logN) & cancel needs index tracking; 100K timers = 17 levels of cache miss
+// - why not 1 flat wheel?
+//   . 30s at 1ms = 30K slots to scan or skip; 4x256 covers 49 days in 4KB of heads
+// - why cb in advance() than via MsgSelf?
+//   . both in main thread; usr cb can newMsgOK() itself if it wants MsgSelf's priority
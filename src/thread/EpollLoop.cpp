@@ -0,0 +1,97 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include "EpollLoop.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+EpollLoop::EpollLoop(MT_EvFdNotifier& aPing, const LogName& aUniLogName) noexcept
+    : UniLog(aUniLogName)
+    , ping_(aPing)
+    , epFd_(epoll_create1(EPOLL_CLOEXEC))
+{
+    epoll_event ev{};
+    ev.events  = EPOLLIN;
+    ev.data.fd = ping_.fd();
+    if (epFd_ < 0 || epoll_ctl(epFd_, EPOLL_CTL_ADD, ping_.fd(), &ev) != 0)
+        ERR("(EpollLoop) failed!!! epFd=" << epFd_ << ", pingFd=" << ping_.fd() << ", errno=" << strerror(errno));
+}
+
+// ***********************************************************************************************
+EpollLoop::~EpollLoop() noexcept
+{
+    if (epFd_ >= 0)
+        close(epFd_);
+}
+
+// ***********************************************************************************************
+bool EpollLoop::addFdOK(const int aFd, const uint32_t aEvents, FdCB&& aCB) noexcept
+{
+    if (! aCB || aFd < 0 || aFd == ping_.fd() || fdCBs_.count(aFd))
+    {
+        WRN("(EpollLoop) failed!!! null cb, invalid/ping/dup fd=" << aFd);
+        return false;
+    }
+    epoll_event ev{};
+    ev.events  = aEvents;
+    ev.data.fd = aFd;
+    if (epoll_ctl(epFd_, EPOLL_CTL_ADD, aFd, &ev) != 0)
+    {
+        WRN("(EpollLoop) failed!!! fd=" << aFd << ", errno=" << strerror(errno));
+        return false;
+    }
+    fdCBs_.emplace(aFd, move(aCB));  // except eg bad_alloc: can't recover->terminate
+    return true;
+}
+
+// ***********************************************************************************************
+bool EpollLoop::rmFdOK(const int aFd) noexcept
+{
+    if (fdCBs_.erase(aFd) == 0)
+        return false;
+    (void)epoll_ctl(epFd_, EPOLL_CTL_DEL, aFd, nullptr);  // fail if usr closed fd already: auto removed
+    return true;
+}
+
+// ***********************************************************************************************
+size_t EpollLoop::timedwait(const size_t aSec, const size_t aRestNsec) noexcept
+{
+    if (! mt_reqMainTH(__func__))
+        return 0;
+
+    const auto ms = aSec * 1'000 + (min(aRestNsec, size_t(999'999'999)) + 999'999) / 1'000'000;
+    epoll_event evs[MAX_EVENTS];
+    const auto nEv = epoll_wait(epFd_, evs, MAX_EVENTS, int(min(ms, size_t(INT_MAX))));  // EINTR: as timeout
+
+    size_t nCalled = 0;
+    for (int i = 0; i < nEv; ++i)
+    {
+        const auto fd = evs[i].data.fd;
+        if (fd == ping_.fd())
+        {
+            ping_.consume();  // before usr drains MsgSelf etc (see MT_EvFdNotifier)
+            continue;
+        }
+        const auto it = fdCBs_.find(fd);
+        if (it == fdCBs_.end())
+            continue;  // rm by prev cb
+        try { auto cb = it->second; cb(evs[i].events); }  // copy: cb may rmFdOK() itself
+        catch(...) { ERR("(EpollLoop) cb() except=" << mt_exceptInfo() << ", fd=" << fd); }
+        ++nCalled;
+    }
+    return nCalled;
+}
+
+}  // namespace
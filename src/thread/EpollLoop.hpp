@@ -0,0 +1,79 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: optional main loop helper: 1 blocking epoll_wait() for usr fds & mt_pingMainTH()
+// - why: usr fds (socket/timerfd/signalfd) & MsgSelf/MtInQueue/ThreadBack (all ping main) in 1 wait,
+//   w/o short-timeout polling nor a bridging thread
+// - how:
+//   . ping = MT_EvFdNotifier's fd in the same epoll set; default = g_notifMainTH (REQ: MT_PING_EVENTFD=1)
+//   . timedwait(): call cb of each ready usr fd, consume() ping; then usr drains the rest, eg:
+//       for (;;)
+//       {
+//           loop.timedwait(0, MSG_SELF->waitNs(100'000'000));  // + timed msg & DeadlineDom by MsgSelf
+//           MSG_SELF->handleAllMsg();
+//           mtInQueue.handleAllEle();
+//           (void)THREAD_BACK->hdlDoneFut();
+//       }
+//
+// - core: epFd_, fdCBs_
+// - MT safe: no (main thread ONLY)
+// - mem safe: yes; cb may add/rm any fd (incl itself)
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "MT_EvFdNotifier.hpp"
+#include "MT_PingMainTH.hpp"
+#include "UniLog.hpp"
+
+namespace rlib
+{
+using FdCB = std::function<void(uint32_t aEvents)>;  // aEvents: eg EPOLLIN|EPOLLHUP
+
+// ***********************************************************************************************
+class EpollLoop : public UniLog
+{
+public:
+    explicit EpollLoop(MT_EvFdNotifier& aPing, const LogName& = ULN_DEFAULT) noexcept;
+#if MT_PING_EVENTFD
+    explicit EpollLoop(const LogName& aUniLogName = ULN_DEFAULT) noexcept : EpollLoop(g_notifMainTH, aUniLogName) {}
+#endif
+    ~EpollLoop() noexcept;
+    EpollLoop(const EpollLoop&)            = delete;
+    EpollLoop& operator=(const EpollLoop&) = delete;
+
+    // - aCB in timedwait() when aFd has aEvents (eg EPOLLIN); level-triggered unless usr adds EPOLLET
+    // - aFd still owned by usr: rmFdOK() before close it
+    [[nodiscard]] bool addFdOK(const int aFd, const uint32_t aEvents, FdCB&& aCB) noexcept;
+    bool rmFdOK(const int aFd) noexcept;  // false: not added
+    [[nodiscard]] size_t nFd() const noexcept { return fdCBs_.size(); }
+
+    // - block till any usr fd ready, ping or timeout (1ms unit, rounded up); ret cb# called
+    size_t timedwait(const size_t aSec = 0, const size_t aRestNsec = 100'000'000) noexcept;
+
+private:
+    // -------------------------------------------------------------------------------------------
+    static constexpr int MAX_EVENTS = 64;  // per epoll_wait(); more ready ones in next call
+
+    MT_EvFdNotifier& ping_;
+    const int epFd_;
+    std::unordered_map<int, FdCB> fdCBs_;
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-19  CSZ       1)create
+// ***********************************************************************************************
+// Q&A:
+// - why not call MsgSelf/MtInQueue/ThreadBack in timedwait()?
+//   . thread lib can't depend on msg_self; usr decides order & budget (eg handleNMsg())
+// - why cb copied before call?
+//   . cb may rmFdOK() itself: the running std::function would be destroyed
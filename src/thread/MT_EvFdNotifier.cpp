@@ -0,0 +1,89 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "MT_EvFdNotifier.hpp"
+#include "MT_PingMainTH.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+MT_EvFdNotifier::MT_EvFdNotifier() noexcept
+    : fd_(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+{}
+
+// ***********************************************************************************************
+MT_EvFdNotifier::~MT_EvFdNotifier() noexcept
+{
+    if (fd_ >= 0)
+        close(fd_);
+}
+
+// ***********************************************************************************************
+void MT_EvFdNotifier::mt_notify() noexcept
+{
+    // - same protocol as MT_Notifier::mt_notify()
+    // - EAGAIN (counter max) harmless: fd stays readable
+    atomic_thread_fence(memory_order_seq_cst);
+    if (mt_armed_.load(memory_order_relaxed) && mt_armed_.exchange(false, memory_order_relaxed))
+    {
+        const uint64_t one = 1;
+        [[maybe_unused]] const auto ret = write(fd_, &one, sizeof(one));
+    }
+}
+
+// ***********************************************************************************************
+void MT_EvFdNotifier::consume() noexcept
+{
+    uint64_t nNotify;
+    [[maybe_unused]] const auto ret = read(fd_, &nNotify, sizeof(nNotify));  // EAGAIN if 0: nonblock
+    mt_armed_.store(true, memory_order_relaxed);  // after read: else a write read here is lost
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+// ***********************************************************************************************
+void MT_EvFdNotifier::timedwait(const size_t aSec, const size_t aRestNsec) noexcept
+{
+    if (! mt_reqMainTH(__func__))
+        return;
+
+    timespec deadline{0, 0};
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    const auto ns = deadline.tv_nsec + min(aRestNsec, size_t(999'999'999));  // as MT_Notifier
+    deadline.tv_sec += (aSec + ns / 1'000'000'000);
+    deadline.tv_nsec = ns % 1'000'000'000;
+
+    pollfd pfd{fd_, POLLIN, 0};
+    for (;;)
+    {
+        timespec now{0, 0};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        timespec rest{deadline.tv_sec - now.tv_sec, deadline.tv_nsec - now.tv_nsec};
+        if (rest.tv_nsec < 0)
+        {
+            --rest.tv_sec;
+            rest.tv_nsec += 1'000'000'000;
+        }
+        if (rest.tv_sec < 0)
+            rest = {0, 0};
+
+        // - notified or timeout (fd<0 is ignored by ppoll: timeout only)
+        if (ppoll(&pfd, 1, &rest, nullptr) >= 0 || errno != EINTR)
+            break;
+        // continue for EINTR w/ rest time
+    }
+    consume();  // also after timeout: a write may race w/ it
+}
+
+}  // namespace
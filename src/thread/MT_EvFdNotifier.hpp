@@ -0,0 +1,61 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: MT_Notifier on eventfd: same API + fd(), so main thread can block on it & other fds at once
+// - why: real main loop also watches sockets/timerfd/signalfd; semaphore only blocks in sem_clockwait
+//   (else poll fds w/ short timeout = latency vs cpu, or a bridging thread)
+// - how:
+//   . mt_notify(): armed -> write(fd, 1); coalesced as MT_Notifier (1 write till main re-arms)
+//   . timedwait(): ppoll(fd) w/ relative timeout (CLOCK_MONOTONIC: immune to clock change), consume()
+//   . consume(): read() resets counter & re-arm; REQ: main thread calls it once fd readable (eg EpollLoop)
+//
+// - MT safe: mt_notify() any thread; rest main thread ONLY
+// - class safe: yes (eventfd() failed -> fd()<0: mt_notify() no-op, timedwait() only sleeps)
+// ***********************************************************************************************
+#pragma once
+
+#include <atomic>
+
+namespace rlib
+{
+// ***********************************************************************************************
+class MT_EvFdNotifier
+{
+public:
+    MT_EvFdNotifier() noexcept;
+    ~MT_EvFdNotifier() noexcept;
+    MT_EvFdNotifier(const MT_EvFdNotifier&)            = delete;
+    MT_EvFdNotifier& operator=(const MT_EvFdNotifier&) = delete;
+
+    void mt_notify() noexcept;
+
+    // - no mt_ prefix since main-thread use ONLY
+    void timedwait(const size_t aSec = 0, const size_t aRestNsec = 100'000'000) noexcept;
+    void consume() noexcept;
+    [[nodiscard]] int fd() const noexcept { return fd_; }  // EPOLLIN = notified
+
+private:
+    const int fd_;
+    alignas(64) std::atomic<bool> mt_armed_{true};  // as MT_Notifier
+
+    // -------------------------------------------------------------------------------------------
+#ifdef IN_GTEST
+public:
+    void reset() noexcept { consume(); }
+#endif
+};
+
+}  // namespace
+// ***********************************************************************************************
+// YYYY-MM-DD  Who       v)Modification Description
+// ..........  .........   .......................................................................
+// 2026-10-19  CSZ       1)create
+// ***********************************************************************************************
+// Q&A:
+// - why not replace MT_Notifier?
+//   . eventfd is linux only; semaphore is posix & enough for a main loop w/o fds
+// - why counter mode (not EFD_SEMAPHORE)?
+//   . 1 read() drains all notifies, as MT_Notifier's sem_trywait loop but 1 syscall
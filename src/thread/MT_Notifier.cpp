@@ -18,9 +18,12 @@ namespace rlib
 // ***********************************************************************************************
 void MT_Notifier::mt_notify() noexcept
 {
-    // - safest to sem_post() directly, avoid complex sync scenario
+    // - fence: caller's push (before) vs main's re-arm (in timedwait) - 1 of both sees the other
+    // - load 1st: disarmed (main awake) is the common case under load, no write to shared line
     // - EOVERFLOW harmless: sem stays MAX, wait still works
-    sem_post(&mt_sem_);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (mt_armed_.load(memory_order_relaxed) && mt_armed_.exchange(false, memory_order_relaxed))
+        sem_post(&mt_sem_);
 }
 
 // ***********************************************************************************************
@@ -46,6 +49,8 @@ void MT_Notifier::timedwait(const size_t aSec, const size_t aRestNsec) noexcept
             // - sem_trywait(): want to reduce counter to 0 so no immediate next wakeup
             // - limit=100: cost little time (but counter may not 0 rarely)
             for (int i = 0; i < 100 && sem_trywait(&mt_sem_) == 0; ++i);
+            mt_armed_.store(true, memory_order_relaxed);  // after drain: else a post drained here is lost
+            atomic_thread_fence(memory_order_seq_cst);    // vs mt_notify()'s: usr's drain after sees push
             return;
         }
         // continue for EINTR, etc (spurious wakeup)
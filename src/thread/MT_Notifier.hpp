@@ -9,6 +9,9 @@
 //     * no lost notif
 //   * timeout to prevent sleep forever
 //   * immune to system clock changes
+//   * coalesce: while main thread is awake (not yet back to timedwait()), notify is 1 atomic load
+//     . mt_armed_: true = next notify shall sem_post(); only 1st notify after re-arm posts
+//     . re-armed at timedwait() return (before usr drains its queues), so any later push re-posts
 //
 // - MT safe: YES
 // - class safe: yes
@@ -36,6 +39,7 @@ public:
 
 private:
     sem_t mt_sem_;
+    alignas(64) std::atomic<bool> mt_armed_{true};  // own cache line: producers only read it while disarmed
 
     // -------------------------------------------------------------------------------------------
 #ifdef IN_GTEST
@@ -44,6 +48,7 @@ public:
     {
         sem_destroy(&mt_sem_);
         sem_init(&mt_sem_, 0, 0);
+        mt_armed_.store(true);
     }
 #endif
 };
@@ -59,6 +64,7 @@ public:
 // 2026-03-31  CSZ       2)immune to system clock changes (pthread_cond + CLOCK_MONOTONIC)
 // 2026-04-03  CSZ       3)back semaphore (clock-immune on glibc2.30+, else not support)
 // 2026-04-11  CSZ       - fix notify loss
+// 2026-10-19  CSZ       - coalesce notify by mt_armed_
 // ***********************************************************************************************
 // Q&A:
 // - why semaphore instead of pthread_cond?
@@ -66,3 +72,8 @@ public:
 //   . semaphore is faster than CV
 //   . simpler API
 //   . no spurious wakeup, no need for predicate
+// - why re-arm at timedwait() return, not right before sleep?
+//   . producer pushes while main drains & skips post (disarmed) -> main sleeps w/ data = lost notify
+//   . re-arm 1st: a push either is seen by main's drain, or sees armed & posts (seq_cst fence pair)
+// - why not sem_post() always (sem counts)?
+//   . post w/ main sleeping = futex wake syscall; under load N producers contend on sem's counter
@@ -10,7 +10,7 @@
 
 namespace rlib
 {
-alignas(64) MT_Notifier g_notifMainTH;
+alignas(64) MainTHNotifier g_notifMainTH;
 
 // ***********************************************************************************************
 // - better than in hpp: avoid multi-copy in diff cpp/lib
@@ -9,6 +9,7 @@
 //     . simpler than para to constructing above class(es)
 //   . can base on MT_Notifier
 //     . this file is an example, users can define their own MT_PingMainTH.hpp - eg condition_variable
+//   . -DMT_PING_EVENTFD=1: base on MT_EvFdNotifier, so main thread can wait it w/ own fds (EpollLoop)
 // - MT safe: yes
 // - mem safe: yes
 // ***********************************************************************************************
@@ -16,7 +17,11 @@
 
 #include <thread>
 
+#if MT_PING_EVENTFD
+#include "MT_EvFdNotifier.hpp"
+#else
 #include "MT_Notifier.hpp"
+#endif
 
 namespace rlib
 {
@@ -43,7 +48,13 @@ std::thread::id mt_getMainTH() noexcept;
 // ***********************************************************************************************
 // - can't use ObjAnywhere that is not MT safe
 // - REQ: usr shall not use g_notifMainTH, otherwise impl change may impact his/her code
-extern MT_Notifier g_notifMainTH;
+//   (except EpollLoop that shall know the fd)
+#if MT_PING_EVENTFD
+using MainTHNotifier = MT_EvFdNotifier;
+#else
+using MainTHNotifier = MT_Notifier;
+#endif
+extern MainTHNotifier g_notifMainTH;
 
 // - REQ: can provide diff impl w/o usr code change
 inline void mt_pingMainTH()
@@ -64,4 +75,5 @@ inline void timedwait(const size_t aSec = 0, const size_t aRestNsec = 100'000'00
 // YYYY-MM-DD  Who       v)Modification Description
 // ..........  .........   .......................................................................
 // 2023-10-25  CSZ       1)create
+// 2026-10-19  CSZ       - MT_PING_EVENTFD
 // ***********************************************************************************************
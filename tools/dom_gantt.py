@@ -4,6 +4,8 @@ REQ: Domino log -> tab-separated .csv -> Excel stacked-bar Gantt
 VALUE: visualize events from Domino log
 
 Input:  Domino log with '(Domino) evName=T/F' and optionally 'parent -T-> child'
+        . text TRC log, or binary TRC file (TrcBin.hpp; auto-detected by magic)
+        . --decode: binary TRC file -> text TRC lines to stdout (no gantt)
 Output: build/gantt.csv  (tab-separated, BOM UTF-8, sorted by start)
     Columns:
     timestamp   - first event appears in log; or back to same state for n-go
@@ -32,7 +34,7 @@ Excel (one-time setup, then Refresh All forever):
                     -> shows X + every event that leads to X.
                     Pipe separators prevent false matches (|47| won't hit |147|).
 """
-import argparse, re, sys
+import argparse, re, struct, sys, time
 from pathlib import Path
 
 # -- RegExps -------------------------------------------------------------------------------------
@@ -49,6 +51,92 @@ def _timestamp(line):
     sec = int(hour) * 3600 + int(minute) * 60 + int(second) + int(frac) / 10 ** len(frac)
     return hit[0], sec
 
+# -- binary TRC (TrcBin.hpp) -> text lines -------------------------------------------------------
+_BIN_MAGIC = b'DOMTRCB1'
+_BIN_ENDIAN_MARK = 0x01020304
+_RE_CSPEC = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(?:hh|h|ll|l|L|q|j|z|t)?([diouxXeEfFgGcsp%])')
+
+def _cformat(fmt, args):
+    """C printf -> python %: drop length modifiers (%zu), %p as hex, %c from int."""
+    args = list(args)
+    def one(hit):
+        flags, width, prec, conv = hit[1], hit[2] or '', hit[3], hit[4]
+        if conv == '%':
+            return '%'
+        if width == '*':
+            width = str(args.pop(0)) if args else ''
+        if prec == '*':
+            prec = str(args.pop(0)) if args else None
+        arg = args.pop(0) if args else ''
+        if conv == 'p':
+            return '0x{:x}'.format(arg)
+        if conv == 'c' and isinstance(arg, int):
+            arg = chr(arg & 0xFF)
+        if conv == 'u':
+            conv = 'd'
+        spec = '%' + flags + width + ('' if prec is None else '.' + prec) + conv
+        try:
+            return spec % arg
+        except (TypeError, ValueError):
+            return str(arg)
+    return _RE_CSPEC.sub(one, fmt)
+
+def _bin_ts(ns):
+    """raw ns -> 'ddd/HH:MM:SS.123456' as text TRC (mt_timestamp)."""
+    sec, us = divmod(ns // 1000, 1_000_000)
+    return '{}.{:06d}'.format(time.strftime('%j/%H:%M:%S', time.localtime(sec)), us)
+
+def decode_bin(data):
+    """binary TRC bytes -> text TRC lines sorted by time (threads' bufs interleave in file)."""
+    if data[:8] != _BIN_MAGIC:
+        raise ValueError('not binary TRC')
+    order = '<' if struct.unpack_from('<I', data, 8)[0] == _BIN_ENDIAN_MARK else '>'
+    id_fmt_S, recs = {}, []
+    pos, end = 12, len(data)
+    try:
+        while pos < end:
+            kind = data[pos:pos + 1]
+            pos += 1
+            if kind == b'F':
+                fmtId, n = struct.unpack_from(order + 'IH', data, pos)
+                pos += 6
+                id_fmt_S[fmtId] = data[pos:pos + n].decode(errors='replace')
+                pos += n
+            elif kind == b'R':
+                fmtId, ns, nArg = struct.unpack_from(order + 'IqB', data, pos)
+                pos += 13
+                args = []
+                for _ in range(nArg):
+                    tag = data[pos:pos + 1]
+                    pos += 1
+                    if tag == b's':
+                        n = data[pos]
+                        args.append(data[pos + 1:pos + 1 + n].decode(errors='replace'))
+                        pos += 1 + n
+                    elif tag == b'c':
+                        args.append(chr(data[pos]))
+                        pos += 1
+                    else:
+                        args.append(struct.unpack_from(order + {b'i': 'q', b'u': 'Q', b'p': 'Q', b'd': 'd'}[tag],
+                                                       data, pos)[0])
+                        pos += 8
+                recs.append((ns, len(recs), fmtId, args))
+            else:
+                raise ValueError('bad record kind {!r} at {}'.format(kind, pos - 1))
+    except (struct.error, IndexError, KeyError):
+        print('WRN: truncated binary TRC at byte {}'.format(pos), file=sys.stderr)  # eg crash w/o flush
+    recs.sort()
+    return ['{} {}'.format(_bin_ts(ns), _cformat(id_fmt_S.get(fmtId, '?fmt#{}'.format(fmtId)), args))
+            for ns, _, fmtId, args in recs]
+
+def _log_lines(log_path):
+    """text or binary TRC -> iterable of text lines."""
+    with open(log_path, 'rb') as log_file:
+        data = log_file.read()
+    if data[:8] == _BIN_MAGIC:
+        return decode_bin(data)
+    return data.decode(errors='replace').splitlines()
+
 # -- parse: scan log -> timing + prev links ------------------------------------------------------
 def parse(log_path):
     """Return (en_1stSec_S, en_lastSec_S, en_1stTsStr_S, en_pre_S).
@@ -61,52 +149,51 @@ def parse(log_path):
     en_enN_S = {}        # en -> en with #N suffix if n-go
     en_initState_S = {}  # en -> init state=T/F
 
-    with open(log_path, errors='replace') as log_file:
-        for line in log_file:
-            if '(Domino)' not in line:
-                continue
-
-            # link: parent -T/F-> child
-            hit = _RE_LINK.search(line)
-            if hit:
-                parent = en_enN_S.get(hit[1], hit[1])
-                child = en_enN_S.get(hit[2], hit[2])
-                if parent not in en_pre_S.setdefault(child, []):
-                    en_pre_S[child].append(parent)
-                continue
-
-            # state change: en=T or en=F
-            hit = _RE_STATE.search(line)
-            if not hit:
-                continue
-            en = hit[1]
-            ts = _timestamp(line)
-            if ts is None:
-                continue
-            tsStr, tsSec = ts
-
-            # remember which direction the first change goes
-            if en not in en_initState_S:
-                en_initState_S[en] = hit[2]
-            # same direction as first observation = changed; opposite = back to initial
-            is_changed = (hit[2] == en_initState_S[en])
-
-            # n-go: back to initial then changed again -> new run
-            if is_changed and en in ended_S:
-                en_nRun_S[en] = en_nRun_S.get(en, 1) + 1
-                ended_S.discard(en)
-
-            nRun = en_nRun_S.get(en, 1)
-            enN = en if nRun == 1 else '{}#{}'.format(en, nRun)
-            en_enN_S[en] = enN
-
-            if enN not in en_1stSec_S:
-                en_1stSec_S[enN] = tsSec
-                en_1stTsStr_S[enN] = tsStr
-            en_lastSec_S[enN] = tsSec
-
-            if not is_changed:
-                ended_S.add(en)
+    for line in _log_lines(log_path):
+        if '(Domino)' not in line:
+            continue
+
+        # link: parent -T/F-> child
+        hit = _RE_LINK.search(line)
+        if hit:
+            parent = en_enN_S.get(hit[1], hit[1])
+            child = en_enN_S.get(hit[2], hit[2])
+            if parent not in en_pre_S.setdefault(child, []):
+                en_pre_S[child].append(parent)
+            continue
+
+        # state change: en=T or en=F
+        hit = _RE_STATE.search(line)
+        if not hit:
+            continue
+        en = hit[1]
+        ts = _timestamp(line)
+        if ts is None:
+            continue
+        tsStr, tsSec = ts
+
+        # remember which direction the first change goes
+        if en not in en_initState_S:
+            en_initState_S[en] = hit[2]
+        # same direction as first observation = changed; opposite = back to initial
+        is_changed = (hit[2] == en_initState_S[en])
+
+        # n-go: back to initial then changed again -> new run
+        if is_changed and en in ended_S:
+            en_nRun_S[en] = en_nRun_S.get(en, 1) + 1
+            ended_S.discard(en)
+
+        nRun = en_nRun_S.get(en, 1)
+        enN = en if nRun == 1 else '{}#{}'.format(en, nRun)
+        en_enN_S[en] = enN
+
+        if enN not in en_1stSec_S:
+            en_1stSec_S[enN] = tsSec
+            en_1stTsStr_S[enN] = tsStr
+        en_lastSec_S[enN] = tsSec
+
+        if not is_changed:
+            ended_S.add(en)
 
     # n-go: propagate prev to later runs (A#2 inherits A's parents)
     for enN in list(en_1stSec_S):
@@ -127,8 +214,13 @@ def main():
         formatter_class=argparse.RawDescriptionHelpFormatter)
     parser.add_argument('log', help='Domino log file')
     parser.add_argument('-o', '--output', default='build/gantt.csv')
+    parser.add_argument('--decode', action='store_true', help='print log as text TRC lines, no gantt')
     args = parser.parse_args()
 
+    if args.decode:
+        sys.stdout.write(''.join(line + '\n' for line in _log_lines(args.log)))
+        return
+
     en_1stSec_S, en_lastSec_S, en_1stTsStr_S, en_pre_S = parse(args.log)
     if not en_1stSec_S:
         print('No (Domino) entries found.', file=sys.stderr)
@@ -185,4 +277,5 @@ if __name__ == '__main__':
     main()
 
 # ------------------------------------------------------------------------------------------------
-# 026-04-17  CSZ  1)init
\ No newline at end of file
+# 026-04-17  CSZ  1)init
+# 2026-10-18  CSZ  - decode binary TRC
@@ -0,0 +1,182 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <chrono>
+
+#include "ConstDom.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+// e0 -T-> e2 <-F- e1, e2 -T-> e3, e1 -T-> e4, e1 -F-> e5
+constexpr const char* SMALL_EN[]   = {"e0", "e1", "e2", "e3", "e4", "e5"};
+constexpr ConstLink   SMALL_LINK[] = {
+    {"e2", "e0", true}, {"e2", "e1", false}, {"e3", "e2", true}, {"e4", "e1", true}, {"e5", "e1", false}};
+constexpr auto SMALL_DAG = makeConstDag(SMALL_EN, SMALL_LINK);
+
+// NE bring-up like: 200 tiles, tile i needs tile i-1 & tile i-10
+constexpr size_t N_TILE = 200;
+struct TileNames { char en_[N_TILE][8]; };
+constexpr TileNames tileNames()
+{
+    TileNames names{};
+    for (size_t i = 0; i < N_TILE; ++i)
+    {
+        names.en_[i][0] = 't';
+        names.en_[i][1] = '0' + i / 100;
+        names.en_[i][2] = '0' + i / 10 % 10;
+        names.en_[i][3] = '0' + i % 10;
+    }
+    return names;
+}
+constexpr TileNames TILE_NAMES = tileNames();
+constexpr auto tileDag()
+{
+    ConstDag<N_TILE, (N_TILE - 1) + (N_TILE - 10)> dag;
+    size_t nLink = 0;
+    for (size_t i = 0; i < N_TILE; ++i)
+    {
+        dag.evNames_[i] = TILE_NAMES.en_[i];
+        if (i >= 1)
+            dag.links_[nLink++] = {TILE_NAMES.en_[i], TILE_NAMES.en_[i - 1], true};
+        if (i >= 10)
+            dag.links_[nLink++] = {TILE_NAMES.en_[i], TILE_NAMES.en_[i - 10], true};
+    }
+    return dag;
+}
+constexpr auto TILE_DAG = tileDag();
+
+// ***********************************************************************************************
+struct ConstDomTest : public UtInitObjAnywhere
+{
+    // same DAG in dyn dom, for cmp
+    template<class aDag> void setDynPrev(MinHdlrDom& aDom, const aDag& aConstDag)
+    {
+        for (auto&& en : aConstDag.evNames_)
+            aDom.newEvent(en);
+        for (auto&& link : aConstDag.links_)
+            aDom.setPrev(link.en_, {{link.prevEn_, link.prevState_}});
+    }
+};
+
+// ***********************************************************************************************
+TEST_F(ConstDomTest, GOLD_sameState_sameHdlr_asDynDom)
+{
+    static_assert(ConstDom<SMALL_DAG>::ev("e3") == 3, "REQ: EvName -> const Event at compile time");
+
+    ConstDom<SMALL_DAG> constDom(uniLogName());
+    MinHdlrDom dynDom(uniLogName());
+    setDynPrev(dynDom, SMALL_DAG);
+
+    multiset<string> constCalled, dynCalled;
+    for (auto&& en : SMALL_EN)
+    {
+        EXPECT_EQ(constDom.ev(en), constDom.setHdlr(en, [&constCalled, en]{ constCalled.insert(en); }));
+        dynDom.setHdlr(en, [&dynCalled, en]{ dynCalled.insert(en); });
+    }
+    for (auto&& simu : {Domino::SimuEvents{{"e0", true}}, {{"e1", true}}, {{"e0", false}, {"e1", false}},
+        {{"e0", true}, {"e1", false}}, {{"e0", true}}})
+    {
+        EXPECT_EQ(dynDom.setState(simu), constDom.setState(simu)) << "REQ: same ret (real changed#)";
+        for (auto&& en : SMALL_EN)
+            EXPECT_EQ(dynDom.state(en), constDom.state(en)) << "REQ: same deduce, en=" << en;
+    }
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ(dynCalled, constCalled) << "REQ: same hdlr calls (incl init T e5 & repeated F->T)";
+}
+
+// ***********************************************************************************************
+TEST_F(ConstDomTest, refuse_nonHead_unknown_and_rmHdlr)
+{
+    ConstDom<SMALL_DAG> dom(uniLogName());
+    EXPECT_EQ(0u, dom.setState({{"e0", true}, {"e3", true}})) << "REQ: refuse non-head (like Domino)";
+    EXPECT_FALSE(dom.state("e0")) << "REQ: refuse all";
+    EXPECT_EQ(0u, dom.setState({{"unknown", true}})) << "REQ: const DAG can't create ev";
+    EXPECT_EQ(0u, dom.setState(ConstDom<SMALL_DAG>::ev("e2"), true)) << "REQ: fast API also refuse non-head";
+    EXPECT_FALSE(dom.state("unknown"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, dom.getEventBy("e"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, dom.getEventBy("e6"));
+
+    size_t nCalled = 0;
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, dom.setHdlr("unknown", [&nCalled]{ ++nCalled; }));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, dom.setHdlr("e3", nullptr));
+    EXPECT_EQ(3u, dom.setHdlr("e3", [&nCalled]{ ++nCalled; }));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, dom.setHdlr("e3", [&nCalled]{ ++nCalled; })) << "REQ: no overwrite";
+    EXPECT_EQ(1u, dom.nHdlr("e3"));
+
+    EXPECT_EQ(1u, dom.setState(ConstDom<SMALL_DAG>::ev("e0"), true));
+    EXPECT_TRUE(dom.state("e3"));
+    EXPECT_TRUE(dom.rmOneHdlrOK("e3"));
+    EXPECT_FALSE(dom.rmOneHdlrOK("e3"));
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ(0u, nCalled) << "REQ: rm hdlr even cb on road (like HdlrDomino)";
+}
+
+// ***********************************************************************************************
+TEST_F(ConstDomTest, GOLD_perf_startup_propagate)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N_WAVE    = 1'000;
+    constexpr size_t HDLR_STEP = N_TILE;  // 1 hdlr/wave: measure propagate than msg
+    using Clock = chrono::steady_clock;
+    auto us = [](auto aT0, auto aT1) { return chrono::duration_cast<chrono::microseconds>(aT1 - aT0).count(); };
+    size_t nHdlr = 0;
+    traceOn_ = false;  // measure dom, not log
+
+    // const
+    auto t0 = Clock::now();
+    ConstDom<TILE_DAG> constDom(uniLogName());
+    for (size_t i = 0; i < N_TILE; i += HDLR_STEP)
+        constDom.setHdlr(TILE_NAMES.en_[i], [&nHdlr]{ ++nHdlr; });
+    auto t1 = Clock::now();
+    for (size_t i = 0; i < N_WAVE; ++i)
+    {
+        constDom.setState(ConstDom<TILE_DAG>::ev("t000"), true);
+        constDom.setState(ConstDom<TILE_DAG>::ev("t000"), false);
+    }
+    auto t2 = Clock::now();
+    const auto usConstStartup = us(t0, t1);
+    const auto usConstWaves   = us(t1, t2);
+    EXPECT_TRUE(constDom.state("t000") == false && constDom.state("t199") == false);
+
+    // dyn
+    t0 = Clock::now();
+    MinHdlrDom dynDom(uniLogName());
+    setDynPrev(dynDom, TILE_DAG);
+    for (size_t i = 0; i < N_TILE; i += HDLR_STEP)
+        dynDom.setHdlr(TILE_NAMES.en_[i], [&nHdlr]{ ++nHdlr; });
+    t1 = Clock::now();
+    for (size_t i = 0; i < N_WAVE; ++i)
+    {
+        dynDom.setState({{"t000", true}});
+        dynDom.setState({{"t000", false}});
+    }
+    t2 = Clock::now();
+    const auto usDynStartup = us(t0, t1);
+    const auto usDynWaves   = us(t1, t2);
+
+    traceOn_ = true;
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ(2 * N_WAVE * N_TILE / HDLR_STEP, nHdlr);
+
+    // REQ: const startup much faster than dyn; propagate not slower (loose: noisy in full ut run)
+    // - measured (-O1, TRC off, 200 tiles & 389 links; 1 setState() = 1 wave of 200 ev):
+    //   . startup   : const ~7us vs dyn ~300us (~40x): no setPrev()/newEvent()/hash at all
+    //   . propagate : const ~8ms vs dyn ~15-24ms per 2K waves (~2.5x), alone & in full ut run
+    //     . but once ~21ms both in full ut run (heap/cache state left by prev cases), so only guard
+    //       const <= 1.5x dyn
+    //     . const has no stack/heap & deduces each ev once; but wave is a serial dependency chain
+    EXPECT_LT(usConstStartup * 10, usDynStartup) << "startup: const=" << usConstStartup << "us, dyn=" << usDynStartup << "us";
+    EXPECT_LE(usConstWaves * 2, usDynWaves * 3) << "propagate " << 2 * N_WAVE << " waves: const=" << usConstWaves
+        << "us, dyn=" << usDynWaves << "us";
+}
+
+}  // namespace
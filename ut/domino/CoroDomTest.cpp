@@ -0,0 +1,113 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include "CoroDom.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+#ifdef __cpp_impl_coroutine
+using namespace std;
+
+namespace rlib
+{
+using CoroMinDom = CoroDom<MinHdlrDom>;
+using CoroMaxDom = CoroDom<MaxNofreeDom>;
+
+// ***********************************************************************************************
+struct CoroDomTest : public UtInitObjAnywhere
+{
+    struct Guard  // frame alive or not
+    {
+        bool& alive_;
+        explicit Guard(bool& aAlive) : alive_(aAlive) { alive_ = true; }
+        ~Guard() { alive_ = false; }
+    };
+
+    static DomTask upgrade(CoroMinDom& aDom, vector<int>& aSteps, bool& aAlive)
+    {
+        Guard guard(aAlive);
+        aSteps.push_back(1);
+        co_await aDom.risen("link up");
+        aSteps.push_back(2);
+        co_await aDom.fallen("link up");
+        aSteps.push_back(3);
+        co_await aDom.risen("cfg done");  // already T: no suspend
+        aSteps.push_back(4);
+    }
+    static DomTask waitOnce(CoroMaxDom& aDom, const char* aEN, vector<string>& aCalled)
+    {
+        co_await aDom.risen(aEN);
+        aCalled.push_back(aEN);
+    }
+};
+
+// ***********************************************************************************************
+TEST_F(CoroDomTest, GOLD_seqWaits_inOneFrame)
+{
+    CoroMinDom dom(uniLogName());
+    dom.setState({{"cfg done", true}});
+    vector<int> steps;
+    bool alive = false;
+    upgrade(dom, steps, alive);
+    EXPECT_EQ(vector<int>{1}, steps) << "REQ: eager till 1st wait";
+    EXPECT_EQ(1u, dom.nCoro("link up"));
+
+    dom.setState({{"link up", true}});
+    EXPECT_EQ(vector<int>{1}, steps) << "REQ: resume via MsgSelf, not in setState()";
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ((vector<int>{1, 2}), steps);
+    EXPECT_TRUE(alive);
+
+    dom.setState({{"link up", false}});
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ((vector<int>{1, 2, 3, 4}), steps) << "REQ: fallen & already-T";
+    EXPECT_FALSE(alive) << "REQ: frame freed at end";
+    EXPECT_EQ(0u, dom.nCoro("link up"));
+}
+
+// ***********************************************************************************************
+TEST_F(CoroDomTest, resumeAtTilePri_andFlapped)
+{
+    CoroMaxDom dom(uniLogName());
+    dom.setPriority("hi", EMsgPri_HIGH);
+    vector<string> called;
+    waitOnce(dom, "lo", called);
+    waitOnce(dom, "hi", called);
+    waitOnce(dom, "hi", called);
+    EXPECT_EQ(2u, dom.nCoro("hi")) << "REQ: multi coro on 1 tile";
+
+    dom.setState({{"lo", true}, {"hi", true}});
+    dom.setState({{"hi", false}});  // flap before resume
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ((vector<string>{"hi", "hi", "lo"}), called) << "REQ: tile's pri; edge not lost by flap";
+}
+
+// ***********************************************************************************************
+TEST_F(CoroDomTest, domGone_orEvRm_freeFrame)
+{
+    vector<int> steps;
+    bool alive = false;
+    {
+        CoroMinDom dom(uniLogName());
+        upgrade(dom, steps, alive);
+        dom.setState({{"link up", true}});  // resume msg on road
+        EXPECT_TRUE(alive);
+    }
+    EXPECT_FALSE(alive) << "REQ: dom gone -> frame freed";
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ(vector<int>{1}, steps) << "REQ: on-road resume no-op";
+
+    CoroMaxDom dom(uniLogName());
+    vector<string> called;
+    waitOnce(dom, "x", called);
+    EXPECT_TRUE(dom.rmEvOK("[await] x=T"));
+    EXPECT_EQ(0u, dom.nCoro("x")) << "REQ: rm await tile -> frame freed";
+    dom.setState({{"x", true}});
+    MSG_SELF->handleAllMsg();
+    EXPECT_TRUE(called.empty());
+}
+
+}  // namespace
+#endif  // __cpp_impl_coroutine
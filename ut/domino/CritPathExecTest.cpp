@@ -0,0 +1,148 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "CritPathExec.hpp"
+#include "ThPoolBack.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct CritPathExecTest : public UtInitObjAnywhere
+{
+    CritPathExecTest() { EXPECT_TRUE(ObjAnywhere::emplaceObjOK<ThreadBack>(MAKE_PTR<ThPoolBack>(2), *this)); }
+
+    // upgrade-like: 6 short cfg tasks (added 1st) + long chain download->verify->install->activate
+    void addUpgradeDag(CritPathExec& aExec, size_t aMsShort, size_t aMsLong)
+    {
+        for (auto&& en : {"cfg0", "cfg1", "cfg2", "cfg3", "cfg4", "cfg5"})
+            EXPECT_TRUE(aExec.addTaskOK(en, task(en, aMsShort), aMsShort * 1000));
+        const char* chain[] = {"download", "verify", "install", "activate"};
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_TRUE(aExec.addTaskOK(chain[i], task(chain[i], aMsLong), aMsLong * 1000,
+                i == 0 ? Domino::EvNames{} : Domino::EvNames{chain[i - 1]}));
+    }
+    MT_TaskEntryFN task(const string& aEN, size_t aMs)
+    {
+        return [this, aEN, aMs]
+        {
+            {
+                lock_guard<mutex> lock(mt_mutex_);
+                mt_started_.push_back(aEN);
+            }
+            this_thread::sleep_for(chrono::milliseconds(aMs));
+            return make_safe<bool>(true);
+        };
+    }
+    void runAll(CritPathExec& aExec)
+    {
+        while (aExec.isBusy())
+            if (THREAD_BACK->hdlDoneFut() == 0)
+                timedwait();
+    }
+
+    mutex mt_mutex_;
+    vector<string> mt_started_;
+};
+
+// ***********************************************************************************************
+TEST_F(CritPathExecTest, GOLD_critPathFirst_thenFifo)
+{
+    CritPathExec exec(2, uniLogName());
+    addUpgradeDag(exec, 1, 2);
+    EXPECT_EQ(2000u, exec.cost("download")) << "REQ: declared cost before any run";
+
+    EXPECT_TRUE(exec.startOK());
+    EXPECT_FALSE(exec.startOK()) << "REQ: no restart while busy";
+    EXPECT_FALSE(exec.addTaskOK("late", []{ return make_safe<bool>(true); }, 1)) << "REQ: no change while busy";
+    runAll(exec);
+    EXPECT_TRUE(exec.isDone("activate"));
+    EXPECT_EQ(10u, exec.stats().nDone_);
+    EXPECT_EQ(2u, exec.stats().maxRunning_) << "REQ: limit concurrency";
+    EXPECT_GT(exec.stats().parallelism(), 1.0) << "REQ: report achieved parallelism";
+    {
+        lock_guard<mutex> lock(mt_mutex_);
+        EXPECT_TRUE(mt_started_[0] == "download" || mt_started_[1] == "download") << "REQ: longest path 1st";
+        EXPECT_EQ(10u, mt_started_.size());
+        mt_started_.clear();
+    }
+    EXPECT_NE(2000u, exec.cost("download")) << "REQ: history replaces declared";
+
+    EXPECT_TRUE(exec.startOK(ECritOrder_FIFO));
+    EXPECT_FALSE(exec.isDone("activate")) << "REQ: n-go reset";
+    runAll(exec);
+    EXPECT_TRUE(exec.isDone("activate"));
+    lock_guard<mutex> lock(mt_mutex_);
+    EXPECT_TRUE(mt_started_[0] != "download" && mt_started_[1] != "download") << "REQ: FIFO = add order";
+}
+
+// ***********************************************************************************************
+TEST_F(CritPathExecTest, failOrBadDag_nok)
+{
+    CritPathExec exec(0, uniLogName());
+    EXPECT_FALSE(exec.addTaskOK("null", nullptr, 1));
+    EXPECT_TRUE(exec.addTaskOK("a", []{ return SafePtr<void>(); }, 1));
+    EXPECT_TRUE(exec.addTaskOK("b", []{ return make_safe<bool>(true); }, 1, {"a"}));
+    EXPECT_FALSE(exec.addTaskOK("a", []{ return make_safe<bool>(true); }, 1)) << "REQ: no dup";
+    EXPECT_EQ(0u, exec.cost("unknown"));
+
+    EXPECT_TRUE(exec.startOK());
+    EXPECT_EQ(1u, exec.stats().maxRunning_) << "REQ: 0 -> 1";
+    runAll(exec);
+    EXPECT_EQ(1u, exec.stats().nFail_) << "REQ: ret nullptr is failure";
+    EXPECT_FALSE(exec.isDone("b")) << "REQ: next of failed never run";
+    EXPECT_FALSE(exec.isBusy());
+
+    EXPECT_TRUE(exec.addTaskOK("c", []{ return make_safe<bool>(true); }, 1, {"unknown"}));
+    EXPECT_FALSE(exec.startOK()) << "REQ: unknown prev";
+
+    CritPathExec loop(1, uniLogName());
+
+    EXPECT_TRUE(loop.addTaskOK("x", []{ return make_safe<bool>(true); }, 1, {"y"}));
+    EXPECT_TRUE(loop.addTaskOK("y", []{ return make_safe<bool>(true); }, 1, {"x"}));
+    EXPECT_FALSE(loop.startOK()) << "REQ: loop";
+    EXPECT_FALSE(loop.startOK(ECritOrder_MAX));
+}
+TEST_F(CritPathExecTest, dupPrev_runOnce)
+{
+    CritPathExec exec(2, uniLogName());
+    EXPECT_TRUE(exec.addTaskOK("a", task("a", 0), 1));
+    EXPECT_TRUE(exec.addTaskOK("b", task("b", 0), 1, {"a", "a"}));
+    EXPECT_TRUE(exec.startOK());
+    runAll(exec);
+    EXPECT_TRUE(exec.isDone("b"));
+    EXPECT_EQ(2u, exec.stats().nDone_) << "REQ: dup prev -> task run once";
+    lock_guard<mutex> lock(mt_mutex_);
+    EXPECT_EQ((vector<string>{"a", "b"}), mt_started_);
+}
+
+// ***********************************************************************************************
+TEST_F(CritPathExecTest, GOLD_perf_makespan_vsFifo)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    // - ideal (2 thread): FIFO = 3 x 10ms cfg + 4 x 20ms chain = 110ms; crit path = 80ms (cfg aside chain)
+    CritPathExec exec(2, uniLogName());
+    addUpgradeDag(exec, 10, 20);
+    EXPECT_TRUE(exec.startOK(ECritOrder_FIFO));
+    runAll(exec);
+    const auto usFifo = exec.stats().usMakespan_;
+    EXPECT_TRUE(exec.startOK());
+    runAll(exec);
+    const auto usCrit = exec.stats().usMakespan_;
+
+    EXPECT_LT(usCrit + 15'000, usFifo) << "crit=" << usCrit << "us, fifo=" << usFifo << "us";
+    EXPECT_GT(exec.stats().parallelism(), 1.5) << "REQ: chain & cfg overlap";
+}
+
+}  // namespace
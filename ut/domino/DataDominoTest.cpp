@@ -104,6 +104,6 @@ REGISTER_TYPED_TEST_SUITE_P(DataDominoTest
     , correct_data_destructor
     , nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
-using AnyDatDom = Types<MinDatDom, MinWbasicDatDom, MaxNofreeDom, MaxDom>;
+using AnyDatDom = Types<MinDatDom, MinWbasicDatDom, MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, DataDominoTest, AnyDatDom);
 }  // namespace
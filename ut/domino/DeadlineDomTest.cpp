@@ -0,0 +1,74 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <thread>
+
+#include "DeadlineDom.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+namespace rlib
+{
+using DeadlineHdlrDom = DeadlineDom<MinHdlrDom>;
+
+// ***********************************************************************************************
+struct DeadlineDomTest : public UtInitObjAnywhere {};
+
+// ***********************************************************************************************
+TEST_F(DeadlineDomTest, GOLD_notInTime_timeoutTile)
+{
+    DeadlineHdlrDom dom(uniLogName());
+    dom.setPrev("rollback", {{"install timeout", true}});  // usr chain on timeout
+    EXPECT_EQ(dom.getEventBy("install done"), dom.setDeadline("install done", 30, "install timeout"));
+    EXPECT_TRUE(dom.hasDeadline("install done"));
+    EXPECT_LE(MSG_SELF->waitNs(1'000'000'000), 31'000'000u) << "REQ: main loop wakes up by deadline";
+
+    MSG_SELF->handleAllMsg();
+    EXPECT_FALSE(dom.state("install timeout"));
+    this_thread::sleep_for(40ms);
+    MSG_SELF->handleAllMsg();  // REQ: deadline driven by main loop's usual MsgSelf call only
+    EXPECT_TRUE(dom.state("install timeout")) << "REQ: not done in time";
+    EXPECT_TRUE(dom.state("rollback")) << "REQ: timeout tile chains as any tile";
+    EXPECT_FALSE(dom.hasDeadline("install done"));
+    EXPECT_EQ(1'000'000'000u, MSG_SELF->waitNs(1'000'000'000)) << "REQ: no timer, no early wakeup";
+}
+
+// ***********************************************************************************************
+TEST_F(DeadlineDomTest, inTime_orRm_noTimeout)
+{
+    DeadlineHdlrDom dom(uniLogName());
+    dom.setDeadline("a", 10, "a timeout");
+    dom.setState({{"a", true}});
+    EXPECT_FALSE(dom.hasDeadline("a")) << "REQ: cancel at once when in time";
+    EXPECT_EQ(1'000'000'000u, MSG_SELF->waitNs(1'000'000'000)) << "REQ: timer cancelled";
+    dom.setDeadline("a", 10, "a timeout");
+    EXPECT_FALSE(dom.hasDeadline("a")) << "REQ: no arm if already T";
+
+    dom.setDeadline("b", 10, "b timeout");
+    dom.setDeadline("b", 50, "b timeout");
+    EXPECT_GT(MSG_SELF->waitNs(1'000'000'000), 30'000'000u) << "REQ: re-arm than add";
+    this_thread::sleep_for(20ms);
+    MSG_SELF->handleAllMsg();
+    EXPECT_FALSE(dom.state("b timeout")) << "REQ: latest deadline";
+    EXPECT_TRUE(dom.rmDeadlineOK("b"));
+    EXPECT_FALSE(dom.rmDeadlineOK("b"));
+    {
+        DeadlineHdlrDom gone(uniLogName());
+        gone.setDeadline("c", 10, "c timeout");
+    }
+    EXPECT_EQ(1'000'000'000u, MSG_SELF->waitNs(1'000'000'000)) << "REQ: dom gone -> cancel";
+    this_thread::sleep_for(60ms);
+    MSG_SELF->handleAllMsg();
+    EXPECT_FALSE(dom.state("b timeout"));
+
+    EXPECT_TRUE(ObjAnywhere::emplaceObjOK(S_PTR<MsgSelf>(), *this));
+    DeadlineDom<Domino> noMsgSelf(uniLogName());  // HdlrDomino requires MsgSelf at ctor
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, noMsgSelf.setDeadline("d", 10, "d timeout")) << "REQ: no MSG_SELF";
+}
+
+}  // namespace
@@ -48,6 +48,66 @@ TYPED_TEST_P(DominoTest, invalidEv_retStateFalse)
     EXPECT_FALSE(PARA_DOM->state(99999)) << "REQ: out-of-range event returns false";
 }
 
+#define BULK_STATE
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_bulkQuery_group)
+{
+    Domino::EvNames names;
+    for (size_t i = 0; i < 130; ++i)  // REQ: cross multi words
+        names.push_back("e" + std::to_string(i));
+    PARA_DOM->newEvent("other");
+    const auto group = PARA_DOM->newMask(names);
+    EXPECT_EQ(PARA_DOM->getEventBy("e0"), PARA_DOM->firstFalse(group)) << "REQ: newMask creates unexist ev";
+    EXPECT_EQ(0u, PARA_DOM->countTrue(group));
+    EXPECT_EQ(130u, PARA_DOM->countFalse(group));
+    EXPECT_FALSE(PARA_DOM->allTrue(group));
+
+    Domino::SimuEvents allT;
+    for (auto&& en : names)
+        allT[en] = true;
+    allT["e129"] = false;
+    PARA_DOM->setState(allT);
+    EXPECT_EQ(129u, PARA_DOM->countTrue(group));
+    EXPECT_EQ(1u, PARA_DOM->countFalse(group)) << "REQ: how many F";
+    EXPECT_EQ(PARA_DOM->getEventBy("e129"), PARA_DOM->firstFalse(group)) << "REQ: which F";
+    EXPECT_FALSE(PARA_DOM->allTrue(group));
+
+    PARA_DOM->setState({{"e129", true}});
+    EXPECT_TRUE(PARA_DOM->allTrue(group)) << "REQ: all T";
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->firstFalse(group)) << "REQ: no F";
+    EXPECT_EQ(0u, PARA_DOM->countFalse(group));
+    EXPECT_FALSE(PARA_DOM->state("other")) << "REQ: not in group, not impact";
+}
+TYPED_TEST_P(DominoTest, GOLD_snapshot_diff)
+{
+    PARA_DOM->setPrev("e2", {{"e1", true}});  // e2=ev0, e1=ev1
+    PARA_DOM->newEvent("e3");
+    const auto old = PARA_DOM->snapshot();
+
+    PARA_DOM->setState({{"e1", true}, {"e3", true}});
+    for (size_t i = 0; i < 70; ++i)  // REQ: new ev after old snapshot
+        PARA_DOM->newEvent("new" + std::to_string(i));
+    PARA_DOM->setState({{"new69", true}});
+    const auto now = PARA_DOM->snapshot();
+
+    const Domino::EVs expect = {PARA_DOM->getEventBy("e2"), PARA_DOM->getEventBy("e1"),
+        PARA_DOM->getEventBy("e3"), PARA_DOM->getEventBy("new69")};
+    EXPECT_EQ(expect, Domino::diff(old, now)) << "REQ: changed ev(s) ascending";
+    EXPECT_EQ(expect, Domino::diff(now, old)) << "REQ: symmetric";
+    EXPECT_TRUE(Domino::diff(now, now).empty());
+}
+TYPED_TEST_P(DominoTest, bulkQuery_emptyOrForeignGroup)
+{
+    EXPECT_TRUE(PARA_DOM->allTrue({})) << "REQ: empty group = vacuous T";
+    EXPECT_EQ(0u, PARA_DOM->countTrue({}));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->firstFalse({}));
+
+    const Domino::EvMask foreign = {0, 0, 0b100};  // eg mask from other dom; bits beyond = F
+    EXPECT_FALSE(PARA_DOM->allTrue(foreign));
+    EXPECT_EQ(1u, PARA_DOM->countFalse(foreign));
+    EXPECT_EQ(130u, PARA_DOM->firstFalse(foreign));
+}
+
 #define BROADCAST_STATE
 // ***********************************************************************************************
 TYPED_TEST_P(DominoTest, GOLD_forward_broadcast_trueLink)
@@ -490,6 +550,10 @@ REGISTER_TYPED_TEST_SUITE_P(DominoTest
     , GOLD_setState_thenGetIt
     , invalidEv_retStateFalse
 
+    , GOLD_bulkQuery_group
+    , GOLD_snapshot_diff
+    , bulkQuery_emptyOrForeignGroup
+
     , GOLD_forward_broadcast_trueLink
     , GOLD_forward_broadcast_falseLink
     , setState_onlyAtChainHead
@@ -524,9 +588,52 @@ REGISTER_TYPED_TEST_SUITE_P(DominoTest
     , noID_for_not_exist_EvName
 );
 using AnyDom = Types<Domino, MinDatDom, MinWbasicDatDom, MinHdlrDom, MinMhdlrDom, MinPriDom,
-    MinFreeDom, MinRmEvDom, MaxNofreeDom, MaxDom>;
+    MinFreeDom, MinRmEvDom, MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, DominoTest, AnyDom);
 
+#define ATTR_COLUMN
+// ***********************************************************************************************
+struct AttrDom : public Domino
+{
+    using Domino::newBitAttr_;
+    using Domino::newByteAttr_;
+    using Domino::bitAttr_;
+    using Domino::byteAttr_;
+    using Domino::setBitAttr_;
+    using Domino::setByteAttr_;
+    using Domino::rmEv_;
+};
+TEST(DominoAttrTest, GOLD_column_setGet_lateRegister_clearOnRm)
+{
+    AttrDom dom;
+    const auto bit0 = dom.newBitAttr_();
+    const auto byte0 = dom.newByteAttr_();
+    for (size_t i = 0; i < 100; ++i)  // REQ: cross words
+        dom.newEvent("e" + std::to_string(i));
+    EXPECT_FALSE(dom.bitAttr_(bit0, 99)) << "REQ: default=0";
+    EXPECT_EQ(0u, dom.byteAttr_(byte0, 99));
+
+    dom.setBitAttr_(bit0, 70, true);
+    dom.setByteAttr_(byte0, 70, 7);
+    const auto bit1 = dom.newBitAttr_();  // REQ: late register keeps existing
+    const auto byte1 = dom.newByteAttr_();
+    EXPECT_TRUE(dom.bitAttr_(bit0, 70));
+    EXPECT_EQ(7u, dom.byteAttr_(byte0, 70));
+    EXPECT_FALSE(dom.bitAttr_(bit1, 70)) << "REQ: columns independent";
+    EXPECT_EQ(0u, dom.byteAttr_(byte1, 70));
+    dom.setBitAttr_(bit1, 70, true);
+    dom.setByteAttr_(byte1, 70, 9);
+    EXPECT_FALSE(dom.bitAttr_(bit0, 69)) << "REQ: ev independent";
+    EXPECT_FALSE(dom.bitAttr_(bit0, 100)) << "REQ: invalid ev safe";
+    EXPECT_EQ(0u, dom.byteAttr_(byte1 + 1, 70)) << "REQ: invalid col safe";
+
+    dom.rmEv_(70);
+    EXPECT_FALSE(dom.bitAttr_(bit0, 70)) << "REQ: rm ev clears all columns in 1 pass";
+    EXPECT_FALSE(dom.bitAttr_(bit1, 70));
+    EXPECT_EQ(0u, dom.byteAttr_(byte0, 70));
+    EXPECT_EQ(0u, dom.byteAttr_(byte1, 70));
+}
+
 #define PERF_MEM
 // ***********************************************************************************************
 TEST(DominoMemTest, GOLD_perf_mem)
@@ -575,6 +682,7 @@ TEST(DominoMemTest, GOLD_perf_mem)
     //   . vs no-log: INF removed from hot-path, only TRC remains (~30% of total)
     //   . SSH+docker PTY overhead ~10-20ms (fwrite block-buffered, minimal impact)
     //   . TRACE_OFF=1 env var disables TRC for pure-computation profiling (~190ms)
+    //   . TRACE_BIN=file env var: binary TRC (~230ms) - no snprintf, decode offline by dom_gantt.py
     EXPECT_LE(bytesPerEv, 380u) << "mem/event=" << bytesPerEv
         << "B, total=" << (totalBytes >> 20) << "MB for " << N << " events";
     EXPECT_LE(msDur, 400) << "time=" << msDur << "ms for " << N << " events";
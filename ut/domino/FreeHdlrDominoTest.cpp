@@ -203,7 +203,7 @@ TYPED_TEST_P(FreeMultiHdlrDominoTest, BugFix_noGapBetween_hdlr_and_autoRm)
 
     EXPECT_FALSE(PARA_DOM->isRepeatHdlr(e1));
     PARA_DOM->setState({{"e1", true}});
-    EXPECT_EQ(2u, MSG_SELF->nMsg()) << "req: 2 hdlrs on road";
+    EXPECT_EQ(1u, MSG_SELF->nMsg()) << "req: 2 hdlrs on road (in 1 batch msg)";
 
     this->pongMsgSelf_();
     this->pongMsgSelf_();  // each process 1 low hdlr
@@ -295,7 +295,7 @@ REGISTER_TYPED_TEST_SUITE_P(FreeHdlrDominoTest
 
     , nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
-using AnyFreeDom = Types<MinFreeDom, MaxDom>;
+using AnyFreeDom = Types<MinFreeDom, MaxDom, StaticMaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, FreeHdlrDominoTest, AnyFreeDom);
 
 // ***********************************************************************************************
@@ -308,6 +308,6 @@ REGISTER_TYPED_TEST_SUITE_P(FreeMultiHdlrDominoTest
     , BugFix_multiCallbackOnRoad_noCrash_noMultiCall
     , BugFix_noGapBetween_hdlr_and_autoRm
 );
-using AnyFreeMultiDom = Types<MaxDom>;
+using AnyFreeMultiDom = Types<MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, FreeMultiHdlrDominoTest, AnyFreeMultiDom);
 }  // namespace
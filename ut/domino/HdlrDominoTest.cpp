@@ -4,12 +4,16 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 // ***********************************************************************************************
+#include <atomic>
 #include <gmock/gmock.h>
 #include <set>
+#include <thread>
 
+#include "AsyncBack.hpp"
 #include "UtInitObjAnywhere.hpp"
 
 using std::set;
+using std::vector;
 
 namespace rlib
 {
@@ -126,6 +130,179 @@ TYPED_TEST_P(NofreeHdlrDominoTest, GOLD_trigger_chain_many_calls)
     PARA_DOM->setState({{"e0", true}});   // T->T->T, req: trigger all calls
     this->pongMsgSelf_();
 }
+TYPED_TEST_P(NofreeHdlrDominoTest, GOLD_batchHdlrs_perWave_yieldHigherPri)
+{
+    vector<int> order;
+    PARA_DOM->setHdlr("e0", [&order]{
+        order.push_back(0);
+        EXPECT_TRUE(MSG_SELF->newMsgOK([&order]{ order.push_back(9); }, EMsgPri_HIGH));
+    });
+    PARA_DOM->setLinkedHdlr("e1", [&order]{ order.push_back(1); }, "e0");
+    PARA_DOM->setLinkedHdlr("e2", [&order]{ order.push_back(2); }, "e1");
+
+    const auto nRefMsgSelf = MSG_SELF.use_count();
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_EQ(1u, MSG_SELF->nMsg()) << "REQ: 3 hdlrs of 1 wave in 1 batch msg";
+    EXPECT_EQ(nRefMsgSelf, MSG_SELF.use_count()) << "REQ: batch msg not own MsgSelf (cycle=leak)";
+    this->pongMsgSelf_();
+    EXPECT_EQ(vector<int>({0, 9, 1, 2}), order) << "REQ: keep hdlr order & still yield to higher pri msg";
+    EXPECT_EQ(0u, MSG_SELF->nMsg());
+
+    order.clear();
+    PARA_DOM->setState({{"e0", false}});
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_TRUE(PARA_DOM->rmOneHdlrOK("e1")) << "REQ: rm hdlr in batch on road";
+    this->pongMsgSelf_();
+    EXPECT_EQ(vector<int>({0, 9, 2}), order) << "REQ: rm-ed hdlr not called, others still";
+}
+TYPED_TEST_P(HdlrDominoTest, GOLD_coalesce_flapping_1msg)
+{
+    size_t nCall = 0;
+    PARA_DOM->setHdlr("link up", [&nCall]{ ++nCall; });
+    EXPECT_NE(Domino::D_EVENT_FAILED_RET, PARA_DOM->setCoalesce("link up", ECoalesce_1_PENDING));
+    for (size_t i = 0; i < 100; ++i)
+    {
+        PARA_DOM->setState({{"link up", true}});
+        PARA_DOM->setState({{"link up", false}});
+    }
+    PARA_DOM->setState({{"link up", true}});
+    EXPECT_EQ(1u, MSG_SELF->nMsg()) << "REQ: flapping storm -> at most 1 msg on road";
+
+    this->pongMsgSelf_();
+    EXPECT_EQ(1u, nCall);
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setCoalesce("link up", ECoalesce_MAX));
+}
+TYPED_TEST_P(NofreeHdlrDominoTest, coalesce_skipStale_reArmAfterCall)
+{
+    size_t nCall = 0;
+    PARA_DOM->setHdlr("link up", [&nCall]{ ++nCall; });
+    PARA_DOM->setCoalesce("link up", ECoalesce_1_PENDING_SKIP_STALE);
+    PARA_DOM->setState({{"link up", true}});
+    PARA_DOM->setState({{"link up", false}});
+    PARA_DOM->setState({{"link up", true}});
+    PARA_DOM->setState({{"link up", false}});
+    EXPECT_EQ(1u, MSG_SELF->nMsg());
+    this->pongMsgSelf_();
+    EXPECT_EQ(0u, nCall) << "REQ: skip stale call (F at dispatch)";
+
+    PARA_DOM->setState({{"link up", true}});
+    EXPECT_EQ(1u, MSG_SELF->nMsg()) << "REQ: re-armed after dispatch";
+    this->pongMsgSelf_();
+    EXPECT_EQ(1u, nCall) << "REQ: T at dispatch -> call";
+
+    PARA_DOM->setCoalesce("link up", ECoalesce_NONE);
+    PARA_DOM->setState({{"link up", false}});
+    PARA_DOM->setState({{"link up", true}});
+    PARA_DOM->setState({{"link up", false}});
+    PARA_DOM->setState({{"link up", true}});
+    EXPECT_EQ(2u, MSG_SELF->nMsg()) << "REQ: default no coalesce";
+    this->pongMsgSelf_();
+    EXPECT_EQ(3u, nCall);
+}
+TYPED_TEST_P(HdlrDominoTest, GOLD_fallEdge_noMirrorEv)
+{
+    PARA_DOM->setPrev("link ok", {{"cable in", true}, {"port up", true}});
+    PARA_DOM->setState({{"cable in", true}, {"port up", true}});
+    const auto nEv = PARA_DOM->evNames().size();
+    EXPECT_EQ(PARA_DOM->getEventBy("link ok"), PARA_DOM->setEdge("link ok", EHdlrEdge_FALL));
+    EXPECT_EQ(EHdlrEdge_FALL, PARA_DOM->getEdge(PARA_DOM->getEventBy("link ok")));
+
+    size_t nCall = 0;
+    PARA_DOM->setHdlr("link ok", [&nCall]{ ++nCall; });
+    this->pongMsgSelf_();
+    EXPECT_EQ(0u, nCall) << "REQ: T now: no immediate call";
+
+    PARA_DOM->setState({{"port up", false}});
+    this->pongMsgSelf_();
+    EXPECT_EQ(1u, nCall) << "REQ: call on T->F (via deduce)";
+    EXPECT_EQ(nEv, PARA_DOM->evNames().size()) << "REQ: no mirror not-X ev";
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setEdge("link ok", EHdlrEdge_MAX));
+}
+TYPED_TEST_P(NofreeHdlrDominoTest, fallEdge_immediateCall_ifF)
+{
+    size_t nCall = 0;
+    PARA_DOM->setEdge("e", EHdlrEdge_FALL);
+    PARA_DOM->setHdlr("e", [&nCall]{ ++nCall; });
+    this->pongMsgSelf_();
+    EXPECT_EQ(1u, nCall) << "REQ: F now: immediate call (like rise hdlr if T)";
+
+    PARA_DOM->setState({{"e", true}});
+    this->pongMsgSelf_();
+    EXPECT_EQ(1u, nCall) << "REQ: no call on F->T";
+    PARA_DOM->setState({{"e", false}});
+    this->pongMsgSelf_();
+    EXPECT_EQ(2u, nCall);
+}
+TYPED_TEST_P(NofreeHdlrDominoTest, anyEdge_callOnEachChange)
+{
+    std::vector<bool> states;
+    PARA_DOM->setEdge("e", EHdlrEdge_ANY);
+    EXPECT_EQ(EHdlrEdge_ANY, PARA_DOM->getEdge(PARA_DOM->getEventBy("e")));
+    PARA_DOM->setHdlr("e", [this, &states]{ states.push_back(PARA_DOM->state("e")); });  // immediate: sync cur state
+    this->pongMsgSelf_();
+    PARA_DOM->setState({{"e", true}});
+    this->pongMsgSelf_();
+    PARA_DOM->setState({{"e", false}});
+    this->pongMsgSelf_();
+    PARA_DOM->setState({{"e", false}});  // no change
+    this->pongMsgSelf_();
+    EXPECT_EQ(std::vector<bool>({false, true, false}), states) << "REQ: each change";
+
+    PARA_DOM->setEdge("e", EHdlrEdge_RISE);
+    EXPECT_EQ(EHdlrEdge_RISE, PARA_DOM->getEdge(PARA_DOM->getEventBy("e"))) << "REQ: back to default";
+}
+TYPED_TEST_P(HdlrDominoTest, GOLD_workerHdlr_inThreadBack_thenSetDone)
+{
+    EXPECT_TRUE(ObjAnywhere::emplaceObjOK<ThreadBack>(MAKE_PTR<AsyncBack>(), *this));
+    std::thread::id workTH;
+    int ret = 0;
+    EXPECT_EQ(PARA_DOM->getEventBy("cfg ready"), PARA_DOM->setWorkerHdlr("cfg ready",
+        [&workTH]{ workTH = std::this_thread::get_id(); return make_safe<int>(42); },
+        "cfg done",
+        [&ret](SafePtr<void> aRet){ ret = *safe_cast<int>(aRet).get(); }));
+    PARA_DOM->setHdlr("cfg done", this->hdlr0_);  // usr chain on done
+
+    PARA_DOM->setState({{"cfg ready", true}});
+    this->pongMsgSelf_();  // start worker
+    while (THREAD_BACK->hdlDoneFut() == 0)
+        timedwait();
+    EXPECT_NE(std::this_thread::get_id(), workTH) << "REQ: work in other thread";
+    EXPECT_EQ(42, ret) << "REQ: ret to backFN in main thread";
+    EXPECT_TRUE(PARA_DOM->state("cfg done")) << "REQ: auto set done";
+
+    EXPECT_CALL(*this, hdlr0());
+    this->pongMsgSelf_();
+}
+TYPED_TEST_P(HdlrDominoTest, workerHdlr_failOrRm_noDone)
+{
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setWorkerHdlr("w", nullptr, "w done"));
+    PARA_DOM->setWorkerHdlr("w", []{ return make_safe<int>(1); }, "w done");
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setWorkerHdlr("w", []{ return make_safe<int>(1); }, "w done"))
+        << "REQ: no overwrite (as setHdlr)";
+    PARA_DOM->setState({{"w", true}});
+    this->pongMsgSelf_();
+    EXPECT_FALSE(PARA_DOM->state("w done")) << "REQ: no THREAD_BACK, no crash";
+
+    EXPECT_TRUE(ObjAnywhere::emplaceObjOK<ThreadBack>(MAKE_PTR<AsyncBack>(), *this));
+    PARA_DOM->setWorkerHdlr("fail", []{ return SafePtr<void>(); }, "fail done");
+    PARA_DOM->setState({{"fail", true}});
+    this->pongMsgSelf_();
+    while (THREAD_BACK->hdlDoneFut() == 0)
+        timedwait();
+    EXPECT_FALSE(PARA_DOM->state("fail done")) << "REQ: ret=nullptr is failure";
+
+    PARA_DOM->setWorkerHdlr("rm", []{ return make_safe<int>(1); }, "rm done");
+    PARA_DOM->setState({{"rm", true}});
+    this->pongMsgSelf_();  // work on road
+    if (PARA_DOM->nHdlr("rm") > 0)  // FreeDom already auto-rm
+    {
+        EXPECT_TRUE(PARA_DOM->rmOneHdlrOK("rm"));
+    }
+    while (THREAD_BACK->hdlDoneFut() == 0)
+        timedwait();
+    EXPECT_TRUE(PARA_DOM->state("rm done")) << "REQ: rm hdlr (or FreeDom auto-rm) not stop on-road work";
+}
 TYPED_TEST_P(HdlrDominoTest, wrongOrderPrev_wrongCallback)
 {
     EXPECT_CALL(*this, hdlr0()).Times(0);  // REQ: no callback
@@ -429,7 +606,7 @@ TYPED_TEST_P(HdlrDominoTest, nonConstInterface_shall_createUnExistEvent_withStat
     this->uniqueEVs_.insert(PARA_DOM->getEventBy("e5"));
     EXPECT_EQ(4u, this->uniqueEVs_.size());
 
-    PARA_DOM->nHdlr("e6");  // shall NOT generate new event
+    (void)PARA_DOM->nHdlr("e6");  // shall NOT generate new event
     this->uniqueEVs_.insert(PARA_DOM->getEventBy("e6"));
     EXPECT_EQ(4u, this->uniqueEVs_.size());
 }
@@ -466,6 +643,10 @@ REGISTER_TYPED_TEST_SUITE_P(HdlrDominoTest
 
     , GOLD_trigger_chain_call
     , immediate_chain_call
+    , GOLD_coalesce_flapping_1msg
+    , GOLD_fallEdge_noMirrorEv
+    , GOLD_workerHdlr_inThreadBack_thenSetDone
+    , workerHdlr_failOrRm_noDone
     , wrongOrderPrev_wrongCallback
     , GOLD_safeUpgrade_allPrevBeforeState
 
@@ -488,7 +669,7 @@ REGISTER_TYPED_TEST_SUITE_P(HdlrDominoTest
     , replace_msgSelf
     , bugFix_invalidMsgSelf
 );
-using AnyHdlrDom = Types<MinHdlrDom, MinMhdlrDom, MinFreeDom, MinPriDom, MaxNofreeDom, MaxDom>;
+using AnyHdlrDom = Types<MinHdlrDom, MinMhdlrDom, MinFreeDom, MinPriDom, MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, HdlrDominoTest, AnyHdlrDom);
 
 // ***********************************************************************************************
@@ -496,6 +677,10 @@ REGISTER_TYPED_TEST_SUITE_P(NofreeHdlrDominoTest
     , UC_reTrigger_reCall
 
     , GOLD_trigger_chain_many_calls
+    , GOLD_batchHdlrs_perWave_yieldHigherPri
+    , coalesce_skipStale_reArmAfterCall
+    , fallEdge_immediateCall_ifF
+    , anyEdge_callOnEachChange
 
     , rmHdlrOnRoad_thenReAdd_noCallbackUntilReTrigger
     , hdlrOnRoad_thenRmDom_noCrash_noLeak
@@ -506,4 +691,80 @@ REGISTER_TYPED_TEST_SUITE_P(NofreeHdlrDominoTest
 );
 using AnyNofreeHdlrDom = Types<MinHdlrDom, MinMhdlrDom, MinPriDom, MaxNofreeDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, NofreeHdlrDominoTest, AnyNofreeHdlrDom);
+
+// ***********************************************************************************************
+struct WorkerHdlrTest : public UtInitObjAnywhere
+{
+    WorkerHdlrTest() { EXPECT_TRUE(ObjAnywhere::emplaceObjOK<ThreadBack>(MAKE_PTR<AsyncBack>(), *this)); }
+    void waitDone() { while (THREAD_BACK->hdlDoneFut() == 0) timedwait(); }
+};
+TEST_F(WorkerHdlrTest, GOLD_retAsDoneData)
+{
+    MaxDom dom(uniLogName());
+    EXPECT_EQ(dom.getEventBy("cfg ready"), setWorkerHdlrToData(dom, "cfg ready",
+        []{ return make_safe<int>(42); }, "cfg done"));
+    dom.setState({{"cfg ready", true}});
+    MSG_SELF->handleAllMsg();  // start worker
+    waitDone();
+    EXPECT_TRUE(dom.state("cfg done")) << "REQ: auto set done";
+    ASSERT_TRUE((getData<MaxDom, int>(dom, "cfg done"))) << "REQ: ret stored as done's data";
+    EXPECT_EQ(42, *(getData<MaxDom, int>(dom, "cfg done").get()));
+}
+TEST_F(WorkerHdlrTest, reTriggerWhileRunning_onlyLatestSetDone)
+{
+    std::atomic<int> nRun = 0;
+    std::atomic<bool> release[3] = {false, false, false};
+    MaxNofreeDom dom(uniLogName());
+    setWorkerHdlrToData(dom, "w", [&nRun, &release]{
+        const int run = ++nRun;
+        while (! release[run])
+            std::this_thread::yield();
+        return make_safe<int>(run);
+    }, "w done");
+    dom.setState({{"w", true}});
+    MSG_SELF->handleAllMsg();  // run 1
+    dom.setState({{"w", false}});
+    dom.setState({{"w", true}});
+    MSG_SELF->handleAllMsg();  // run 2 while run 1 on road
+
+    release[1] = true;
+    waitDone();
+    EXPECT_FALSE(dom.state("w done")) << "REQ: stale run's result dropped, latest still running";
+    EXPECT_FALSE((getData<MaxNofreeDom, int>(dom, "w done"))) << "REQ: stale ret not stored";
+
+    release[2] = true;
+    waitDone();
+    EXPECT_TRUE(dom.state("w done")) << "REQ: latest run sets done";
+    EXPECT_EQ(2, *(getData<MaxNofreeDom, int>(dom, "w done").get())) << "REQ: latest ret";
+}
+
+// ***********************************************************************************************
+struct BatchProbeDom : public MinHdlrDom
+{
+    using MinHdlrDom::Batch;
+};
+TEST(HdlrDominoBatchTest, droppedBatch_clearPending_ofNotRunHdlrs)
+{
+    auto&& slab = HdlrSlab::mt_inst();
+    vector<HdlrHandle> hdlrs;
+    for (size_t tag = 0; tag < 3; ++tag)
+    {
+        hdlrs.push_back(slab.newHdlr([]{}, tag));
+        slab.setPending(hdlrs.back(), true);  // as coalesced triggerHdlr_()
+    }
+    EXPECT_TRUE(slab.rmHdlrOK(hdlrs[2])) << "rm-ed while on road";
+    {
+        BatchProbeDom::Batch batch{vector<HdlrHandle>(hdlrs)};
+        batch.next_ = 1;  // 1st run (& may be on road again)
+        BatchProbeDom::Batch resumed(std::move(batch));  // eg resumeMsgOK() failed -> dropped w/o run
+    }
+    EXPECT_TRUE(slab.isPending(hdlrs[0])) << "REQ: run one untouched";
+    EXPECT_FALSE(slab.isPending(hdlrs[1])) << "REQ: dropped w/o run -> can post again";
+
+    const auto reuse = slab.newHdlr([]{}, 9);
+    EXPECT_TRUE(slab.isValid(reuse)) << "REQ: rm-ed hdlr skipped (free list intact)";
+    for (auto&& hdlr : {hdlrs[0], hdlrs[1], reuse})
+        EXPECT_TRUE(slab.rmHdlrOK(hdlr));
+}
+
 }  // namespace
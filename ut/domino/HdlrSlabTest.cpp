@@ -0,0 +1,88 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "HdlrSlab.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+TEST(HdlrSlabTest, GOLD_rm_invalidateOldHandle_reuseSlot)
+{
+    HdlrSlab slab;
+    const auto h1 = slab.newHdlr([]{}, 11);
+    EXPECT_NE(0u, h1) << "REQ: 0 is null handle";
+    EXPECT_TRUE(slab.isValid(h1));
+    EXPECT_EQ(11u, slab.tag(h1));
+    EXPECT_FALSE(slab.isValid(0));
+    EXPECT_FALSE(slab.isPending(h1));
+    slab.setPending(h1, true);
+    EXPECT_TRUE(slab.isPending(h1));
+
+    EXPECT_TRUE(slab.rmHdlrOK(h1));
+    EXPECT_FALSE(slab.isValid(h1)) << "REQ: on-road handle invalid after rm";
+    EXPECT_FALSE(slab.rmHdlrOK(h1)) << "REQ: no double rm";
+    EXPECT_FALSE(slab.take(h1)) << "REQ: nothing to call";
+
+    const auto h2 = slab.newHdlr([]{}, 22);
+    EXPECT_EQ(uint32_t(h1), uint32_t(h2)) << "REQ: reuse slot (dense)";
+    EXPECT_NE(h1, h2) << "REQ: new generation";
+    EXPECT_FALSE(slab.isPending(h2)) << "REQ: new hdlr not pending";
+    EXPECT_FALSE(slab.isValid(h1));
+    EXPECT_EQ(1u, slab.nHdlr());
+}
+
+TEST(HdlrSlabTest, pos_independentOfPending)
+{
+    HdlrSlab slab;
+    const auto h = slab.newHdlr([]{}, 0);
+    EXPECT_EQ(0u, slab.pos(h));
+    slab.setPos(h, 0x7FFF'FFFF);
+    slab.setPending(h, true);
+    EXPECT_EQ(0x7FFF'FFFFu, slab.pos(h)) << "REQ: pending not change pos";
+    slab.setPos(h, 3);
+    EXPECT_TRUE(slab.isPending(h)) << "REQ: pos not change pending";
+    slab.setPending(h, false);
+    EXPECT_EQ(3u, slab.pos(h));
+
+    EXPECT_TRUE(slab.rmHdlrOK(h));
+    const auto h2 = slab.newHdlr([]{}, 0);
+    EXPECT_EQ(0u, slab.pos(h2)) << "REQ: new hdlr pos=0";
+}
+
+// ***********************************************************************************************
+TEST(HdlrSlabTest, rmInCall_releaseAfterCall)
+{
+    HdlrSlab slab;
+    auto res = make_shared<int>(0);
+    HdlrHandle h = 0;
+    h = slab.newHdlr([&slab, &h, res]{ ++*res; EXPECT_TRUE(slab.rmHdlrOK(h)) << "REQ: rm self in call"; }, 0);
+    EXPECT_EQ(2, res.use_count());
+
+    auto cb = slab.take(h);
+    EXPECT_FALSE(slab.take(h)) << "REQ: taken";
+    cb();
+    slab.putBack(h, move(cb));
+    EXPECT_EQ(1, *res);
+    EXPECT_FALSE(slab.isValid(h));
+    EXPECT_EQ(2, res.use_count()) << "REQ: putBack() no-op since rm-ed; cb (local) still alive";
+    cb = nullptr;
+    EXPECT_EQ(1, res.use_count()) << "REQ: no leak";
+
+    const auto h2 = slab.newHdlr([res]{ ++*res; }, 0);
+    cb = slab.take(h2);
+    cb();
+    slab.putBack(h2, move(cb));
+    EXPECT_TRUE(slab.take(h2)) << "REQ: repeat call";
+    EXPECT_TRUE(slab.rmHdlrOK(h2));
+    EXPECT_EQ(1, res.use_count()) << "REQ: rm release captured resrc at once";
+}
+
+}  // namespace
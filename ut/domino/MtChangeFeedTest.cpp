@@ -0,0 +1,182 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Domino.hpp"
+#include "MtChangeFeed.hpp"
+#include "RmEvDom.hpp"
+
+using namespace std;
+using namespace testing;
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct MtChangeFeedTest : public Test, public UniLog
+{
+    MtChangeFeedTest() : UniLog(UnitTest::GetInstance()->current_test_info()->name()) {}
+    ~MtChangeFeedTest() { GTEST_LOG_FAIL }
+
+    vector<DomChange> popAll()
+    {
+        vector<DomChange> changes(feed_->capacity());
+        changes.resize(feed_->mt_pop(changes.data(), changes.size()));
+        return changes;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    Domino dom_{uniLogName()};
+    shared_ptr<MtChangeFeed> feed_ = make_shared<MtChangeFeed>(16);
+};
+
+#define FEED
+// ***********************************************************************************************
+TEST_F(MtChangeFeedTest, GOLD_stateChange_toFeed)
+{
+    EXPECT_TRUE(dom_.setChangeFeedOK(feed_));
+    const auto e1 = dom_.newEvent("e1");
+    const auto e2 = dom_.setPrev("e2", {{"e1", true}});
+    EXPECT_TRUE(popAll().empty()) << "REQ: no state change, no record";
+
+    dom_.setState({{"e1", true}});
+    auto changes = popAll();
+    ASSERT_EQ(2u, changes.size()) << "REQ: record each tile transition incl. deduced";
+    EXPECT_EQ(e1, changes[0].ev);
+    EXPECT_TRUE(changes[0].state);
+    EXPECT_EQ(1u, changes[0].nRun) << "REQ: 1st run";
+    EXPECT_EQ(e2, changes[1].ev)   << "REQ: in propagation order";
+    EXPECT_LE(changes[0].tsNs, changes[1].tsNs) << "REQ: monotonic timestamp";
+
+    dom_.setState({{"e1", false}});
+    dom_.setState({{"e1", true}});
+    changes = popAll();
+    ASSERT_EQ(4u, changes.size());
+    EXPECT_FALSE(changes[0].state);
+    EXPECT_EQ(1u, changes[0].nRun) << "REQ: T & its later F share nRun";
+    EXPECT_TRUE(changes[2].state);
+    EXPECT_EQ(2u, changes[2].nRun) << "REQ: n-go inc nRun";
+    EXPECT_EQ(0u, feed_->mt_nDrop());
+}
+TEST_F(MtChangeFeedTest, optIn_noFeed_noRecord)
+{
+    dom_.setState({{"e1", true}});
+    EXPECT_TRUE(dom_.setChangeFeedOK(feed_));
+    dom_.setState({{"e1", false}});
+    EXPECT_TRUE(dom_.setChangeFeedOK(nullptr));  // REQ: can turn off
+    dom_.setState({{"e1", true}});
+
+    const auto changes = popAll();
+    ASSERT_EQ(1u, changes.size()) << "REQ: record only when feed on";
+    EXPECT_FALSE(changes[0].state);
+}
+TEST_F(MtChangeFeedTest, rmEv_recycledEv_restartNRun)
+{
+    RmEvDom<Domino> dom(uniLogName());
+    EXPECT_TRUE(dom.setChangeFeedOK(feed_));
+    const auto e1 = dom.newEvent("e1");
+    dom.setState({{"e1", true}});
+    dom.setState({{"e1", false}});
+    dom.setState({{"e1", true}});
+    EXPECT_TRUE(dom.rmEvOK("e1"));
+    EXPECT_EQ(e1, dom.newEvent("e2")) << "REQ: recycle ev id";
+    dom.setState({{"e2", true}});
+
+    const auto changes = popAll();
+    ASSERT_EQ(5u, changes.size());
+    EXPECT_FALSE(changes[3].state) << "REQ: rm ev = F";
+    EXPECT_EQ(2u, changes[3].nRun) << "REQ: F of rm ev keeps its nRun";
+    EXPECT_EQ(e1, changes[4].ev);
+    EXPECT_EQ(1u, changes[4].nRun) << "REQ: new tile on recycled ev restarts nRun";
+}
+TEST_F(MtChangeFeedTest, oneFeed_perDom)
+{
+    EXPECT_TRUE(dom_.setChangeFeedOK(feed_));
+    EXPECT_TRUE(dom_.setChangeFeedOK(feed_)) << "REQ: re-set same feed is ok";
+    {
+        Domino dom2(uniLogName());
+        EXPECT_FALSE(dom2.setChangeFeedOK(feed_)) << "REQ: DomChange has no dom id -> no share";
+        dom2.setState({{"e1", true}});
+        EXPECT_TRUE(popAll().empty()) << "REQ: refused dom records nothing";
+
+        EXPECT_TRUE(dom_.setChangeFeedOK(nullptr));
+        EXPECT_TRUE(dom2.setChangeFeedOK(feed_)) << "REQ: ok after detach";
+        dom2.setState({{"e1", false}});
+        EXPECT_EQ(1u, popAll().size());
+    }
+    EXPECT_TRUE(dom_.setChangeFeedOK(feed_)) << "REQ: dom's destructor detach feed";
+}
+
+#define FULL
+// ***********************************************************************************************
+TEST_F(MtChangeFeedTest, GOLD_full_dropNew_andCount)
+{
+    MtChangeFeed feed(3);
+    EXPECT_EQ(4u, feed.capacity()) << "REQ: round up to 2^n";
+    for (size_t ev = 0; ev < 6; ++ev)
+        feed.push(ev, true);
+    EXPECT_EQ(2u, feed.mt_nDrop()) << "REQ: explicit drop counter";
+
+    DomChange change;
+    for (size_t ev = 0; ev < 4; ++ev)
+    {
+        ASSERT_TRUE(feed.mt_pop(change));
+        EXPECT_EQ(ev, change.ev) << "REQ: drop newest, keep oldest";
+    }
+    EXPECT_FALSE(feed.mt_pop(change)) << "REQ: empty";
+
+    feed.push(9, true);  // REQ: reuse freed slot
+    ASSERT_TRUE(feed.mt_pop(change));
+    EXPECT_EQ(9u, change.ev);
+    EXPECT_EQ(2u, feed.mt_nDrop());
+}
+TEST_F(MtChangeFeedTest, invalid_noCrash)
+{
+    MtChangeFeed feed(0);
+    EXPECT_EQ(1u, feed.capacity()) << "REQ: min capacity";
+    feed.push(0, false);
+    EXPECT_EQ(0u, feed.mt_pop(nullptr, 1)) << "REQ: null out";
+    EXPECT_EQ(0u, feed.mt_pop(nullptr, 0));
+}
+
+#define MT
+// ***********************************************************************************************
+TEST_F(MtChangeFeedTest, GOLD_otherThread_consume_noLoss_inOrder)
+{
+    constexpr size_t N = 20'000;
+    atomic<bool> stop(false);
+    vector<DomChange> got;
+    got.reserve(N);
+    thread consumer([&]{
+        DomChange buf[16];
+        for (;;)
+        {
+            const auto n = feed_->mt_pop(buf, 16);
+            got.insert(got.end(), buf, buf + n);
+            if (n == 0 && stop) return;  // stop after drained
+            if (n == 0) this_thread::yield();
+        }
+    });
+
+    size_t nPush = 0;
+    for (size_t i = 0; i < N; ++i)
+    {
+        feed_->push(i, true);
+        ++nPush;
+        if (feed_->mt_nDrop()) this_thread::yield();  // let consumer catch up
+    }
+    stop = true;
+    consumer.join();
+
+    EXPECT_EQ(nPush, got.size() + feed_->mt_nDrop()) << "REQ: each record is popped or counted as drop";
+    for (size_t i = 1; i < got.size(); ++i)
+        ASSERT_LT(got[i - 1].ev, got[i].ev) << "REQ: FIFO across thread";
+}
+
+}  // namespace
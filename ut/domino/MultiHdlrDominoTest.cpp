@@ -12,6 +12,7 @@
 
 using std::set;
 using std::string;
+using std::vector;
 
 namespace rlib
 {
@@ -69,6 +70,51 @@ TYPED_TEST_P(MultiHdlrDominoTest, multiAddHdlr_bySameHdlrName_nok)
     PARA_DOM->setState({{"event", true}});
     this->pongMsgSelf_();
 }
+TYPED_TEST_P(NofreeMultiHdlrDominoTest, GOLD_callInAddOrder_evenAfterRm)
+{
+    vector<int> order;
+    PARA_DOM->multiHdlrOnSameEv("event", [&order]{ order.push_back(3); }, "h3");
+    PARA_DOM->multiHdlrOnSameEv("event", [&order]{ order.push_back(1); }, "h1");
+    PARA_DOM->multiHdlrOnSameEv("event", [&order]{ order.push_back(2); }, "h2");
+    PARA_DOM->setState({{"event", true}});
+    this->pongMsgSelf_();
+    EXPECT_EQ(vector<int>({3, 1, 2}), order) << "REQ: deterministic: call in add order";
+
+    EXPECT_TRUE(PARA_DOM->rmOneHdlrOK("event", "h1"));
+    PARA_DOM->multiHdlrOnSameEv("event", [&order]{ order.push_back(1); }, "h1");  // immediate call
+    PARA_DOM->setState({{"event", false}});
+    PARA_DOM->setState({{"event", true}});
+    this->pongMsgSelf_();
+    EXPECT_EQ(vector<int>({3, 1, 2, 1, 3, 2, 1}), order) << "REQ: rm keeps others' order; re-add to tail";
+}
+TYPED_TEST_P(MultiHdlrDominoTest, coalesce_perHdlr)
+{
+    PARA_DOM->setCoalesce("event", ECoalesce_1_PENDING);
+    PARA_DOM->setHdlr("event", this->hdlr0_);
+    PARA_DOM->multiHdlrOnSameEv("event", this->hdlr1_, "this->hdlr1_");
+    PARA_DOM->setState({{"event", true}});
+    PARA_DOM->setState({{"event", false}});
+    PARA_DOM->multiHdlrOnSameEv("event", this->hdlr2_, "this->hdlr2_");
+    PARA_DOM->setState({{"event", true}});
+
+    EXPECT_CALL(*this, hdlr0());  // REQ: each hdlr coalesced independently
+    EXPECT_CALL(*this, hdlr1());
+    EXPECT_CALL(*this, hdlr2());
+    this->pongMsgSelf_();
+}
+TYPED_TEST_P(MultiHdlrDominoTest, fallEdge_allHdlrOfEv)
+{
+    PARA_DOM->setState({{"event", true}});
+    PARA_DOM->setEdge("event", EHdlrEdge_FALL);
+    PARA_DOM->setHdlr("event", this->hdlr0_);
+    PARA_DOM->multiHdlrOnSameEv("event", this->hdlr1_, "this->hdlr1_");
+    this->pongMsgSelf_();  // T now: no immediate call
+
+    EXPECT_CALL(*this, hdlr0());
+    EXPECT_CALL(*this, hdlr1());
+    PARA_DOM->setState({{"event", false}});
+    this->pongMsgSelf_();
+}
 // ***********************************************************************************************
 // special call hdlr
 // ***********************************************************************************************
@@ -377,7 +423,7 @@ TYPED_TEST_P(MultiHdlrDominoTest, nonConstInterface_shall_createUnExistEvent_wit
     this->uniqueEVs_.insert(PARA_DOM->getEventBy("e2"));
     EXPECT_EQ(2u, this->uniqueEVs_.size());
 
-    PARA_DOM->nHdlr("e3");  // shall NOT generate new event
+    (void)PARA_DOM->nHdlr("e3");  // shall NOT generate new event
     this->uniqueEVs_.insert(PARA_DOM->getEventBy("e3"));
     EXPECT_EQ(2u, this->uniqueEVs_.size());
 
@@ -391,6 +437,8 @@ REGISTER_TYPED_TEST_SUITE_P(MultiHdlrDominoTest
     , GOLD_multiAddHdlr_ok
     , aloneAddHdlr_ok
     , multiAddHdlr_bySameHdlrName_nok
+    , coalesce_perHdlr
+    , fallEdge_allHdlrOfEv
     , immediateCallback_ok
     , BugFix_invalidHdlr_noCrash
 
@@ -412,12 +460,13 @@ REGISTER_TYPED_TEST_SUITE_P(MultiHdlrDominoTest
 
     , nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
-using AnyMultiHdlrDom = Types<MinMhdlrDom, MaxNofreeDom, MaxDom>;
+using AnyMultiHdlrDom = Types<MinMhdlrDom, MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, MultiHdlrDominoTest, AnyMultiHdlrDom);
 
 // ***********************************************************************************************
 REGISTER_TYPED_TEST_SUITE_P(NofreeMultiHdlrDominoTest
     , repeatCallback_ok
+    , GOLD_callInAddOrder_evenAfterRm
 
     , rmHdlrOnRoad
 
@@ -425,4 +474,86 @@ REGISTER_TYPED_TEST_SUITE_P(NofreeMultiHdlrDominoTest
 );
 using AnyNofreeMultiHdlrDom = Types<MinMhdlrDom, MaxNofreeDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, NofreeMultiHdlrDominoTest, AnyNofreeMultiHdlrDom);
+
+// ***********************************************************************************************
+struct NameProbeDom : public MinMhdlrDom
+{
+    using MinMhdlrDom::MinMhdlrDom;
+    using MinMhdlrDom::nHdlrName_;
+};
+struct MultiHdlrNameTest : public UtInitObjAnywhere {};
+TEST_F(MultiHdlrNameTest, GOLD_rmLastHdlr_freeName)
+{
+    NameProbeDom dom(uniLogName());
+    for (int i = 0; i < 1000; ++i)  // eg hdlr per session
+    {
+        const auto hn = "session_" + std::to_string(i);
+        dom.multiHdlrOnSameEv("e1", []{}, hn);
+        dom.multiHdlrOnSameEv("e2", []{}, hn);
+        EXPECT_TRUE(dom.rmOneHdlrOK("e1", hn));
+        EXPECT_EQ(1u, dom.nHdlrName_()) << "REQ: still used by e2";
+        EXPECT_TRUE(dom.rmOneHdlrOK("e2", hn));
+    }
+    EXPECT_EQ(0u, dom.nHdlrName_()) << "REQ: churny names not leak";
+
+    dom.multiHdlrOnSameEv("e1", []{}, "h1");
+    dom.multiHdlrOnSameEv("e2", []{}, "h1");
+    dom.multiHdlrOnSameEv("e2", []{}, "h2");
+    EXPECT_EQ(2u, dom.nHdlrName_()) << "REQ: 1 per distinct name";
+    dom.rmAllHdlr("e2");
+    EXPECT_EQ(1u, dom.nHdlrName_()) << "REQ: rm all also free";
+    EXPECT_FALSE(dom.rmOneHdlrOK("e2", "h1")) << "REQ: name still in use elsewhere != hdlr here";
+    EXPECT_EQ(1u, dom.nHdlr("e1"));
+}
+TEST_F(MultiHdlrNameTest, rmAnyPos_keepAddOrder)
+{
+    NameProbeDom dom(uniLogName());
+    vector<int> order;
+    for (int i = 0; i < 5; ++i)
+        dom.multiHdlrOnSameEv("e", [&order, i]{ order.push_back(i); }, "h" + std::to_string(i));
+    EXPECT_TRUE(dom.rmOneHdlrOK("e", "h0"));  // head: swap-rm moves tail here
+    EXPECT_TRUE(dom.rmOneHdlrOK("e", "h2"));
+    EXPECT_TRUE(dom.rmOneHdlrOK("e", "h3"));  // moved by prev rm: pos updated?
+    dom.multiHdlrOnSameEv("e", [&order]{ order.push_back(5); }, "h5");
+    dom.setState({{"e", true}});
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ(vector<int>({1, 4, 5}), order) << "REQ: rm by pos in any order, still call in add order";
+
+    EXPECT_TRUE(dom.rmOneHdlrOK("e", "h4"));  // after sort: pos renewed
+    EXPECT_EQ(2u, dom.nHdlr("e"));
+}
+
+#define PERF_MEM
+// ***********************************************************************************************
+struct MultiHdlrMemTest : public UtInitObjAnywhere {};
+TEST_F(MultiHdlrMemTest, GOLD_perf_mem_perHdlr)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    // typical: each ev has few hdlrs, named by owner (so same names on many evs)
+    constexpr size_t N_EV = 100'000;
+    constexpr size_t N_HDLR_PER_EV = 3;
+    const string OWNER[N_HDLR_PER_EV] = {"owner_alarm_mgr", "owner_cfg_mgr_xxxxxx", "owner_bringup_ctl_xx"};
+    MinMhdlrDom dom(uniLogName());
+    traceOn_ = false;  // measure dom, not log
+    for (size_t i = 0; i < N_EV; ++i)
+        dom.newEvent("e" + std::to_string(i));  // not measured: ev cost is DominoMemTest's
+
+    const auto rss0 = rssBytes();
+    for (size_t i = 0; i < N_EV; ++i)
+        for (auto&& owner : OWNER)
+            dom.multiHdlrOnSameEv("e" + std::to_string(i), []{}, owner);
+    const auto rss1 = rssBytes();
+    traceOn_ = true;
+
+    const auto bytesPerHdlr = (rss1 > rss0 ? rss1 - rss0 : 0) / (N_EV * N_HDLR_PER_EV);
+    EXPECT_EQ(N_HDLR_PER_EV, dom.nHdlr("e0"));
+    // REQ: mem regression guard (incl HdlrSlab's slot 48B)
+    // - measured (-O1, libstdc++):
+    //   . unordered_map<Event, unordered_map<string, HdlrHandle>>: ~202B/hdlr (2 nodes + heap name)
+    //   . [ev]=vector<{NameID, HdlrHandle}> + interned name           : ~83B/hdlr
+    //   . + add order & name ref-cnt (same 16B per hdlr)                : ~83B/hdlr
+    EXPECT_LE(bytesPerHdlr, 100u) << "mem/hdlr=" << bytesPerHdlr << "B";
+}
 }  // namespace
@@ -119,6 +119,6 @@ REGISTER_TYPED_TEST_SUITE_P(PriDominoTest
     , nonConstInterface_shall_createUnExistEvent_withStateFalse
     , GOLD_setPriority_thenPriorityFifoCallback
 );
-using AnyPriDom = Types<MinPriDom, MaxNofreeDom, MaxDom>;
+using AnyPriDom = Types<MinPriDom, MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, PriDominoTest, AnyPriDom);
 }  // namespace
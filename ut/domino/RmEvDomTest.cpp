@@ -163,7 +163,7 @@ REGISTER_TYPED_TEST_SUITE_P(RmDomTest
     , rmMiddle_thenRebuildLink_noFalseLoop
     , GOLD_nGo_fullLifecycle_createUseRmRepeat
 );
-using AnyRmDom = Types<MinRmEvDom, MaxNofreeDom, MaxDom>;
+using AnyRmDom = Types<MinRmEvDom, MaxNofreeDom, MaxDom, StaticMaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, RmDomTest, AnyRmDom);
 
 #define RM_DATA_DOM
@@ -197,7 +197,7 @@ TYPED_TEST_P(RmDataDomTest, GOLD_rm_DataDom_resrc)
 REGISTER_TYPED_TEST_SUITE_P(RmDataDomTest
     , GOLD_rm_DataDom_resrc
 );
-using AnyRmDataDom = Types<MaxNofreeDom, MaxDom>;
+using AnyRmDataDom = Types<MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, RmDataDomTest, AnyRmDataDom);
 
 #define RM_W_DATA_DOM
@@ -235,7 +235,7 @@ TYPED_TEST_P(RmWdatDomTest, GOLD_rm_WdatDom_resrc)
 REGISTER_TYPED_TEST_SUITE_P(RmWdatDomTest
     , GOLD_rm_WdatDom_resrc
 );
-using AnyRmWdatDom = Types<MaxNofreeDom, MaxDom>;
+using AnyRmWdatDom = Types<MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, RmWdatDomTest, AnyRmWdatDom);
 
 #define RM_HDLR_DOM
@@ -249,14 +249,14 @@ TYPED_TEST_P(RmHdlrDomTest, GOLD_rm_HdlrDom_resrc)
     auto e1 = PARA_DOM->setHdlr("e1", [&hdlrIDs](){ hdlrIDs.insert(1); });
     PARA_DOM->setLinkedHdlr("e2", [&hdlrIDs](){ hdlrIDs.insert(2); }, "e1");
     PARA_DOM->setState({{"e1", true}});
-    EXPECT_EQ(2u, MSG_SELF->nMsg()) << "REQ: 2 hdlrs on road.";
+    EXPECT_EQ(1u, MSG_SELF->nMsg()) << "REQ: 2 hdlrs on road (in 1 batch msg).";
     EXPECT_EQ(0u, hdlrIDs.size()) << "REQ: not callback yet.";
 
     EXPECT_TRUE(PARA_DOM->rmEvOK("e1"));
     EXPECT_EQ(e1, PARA_DOM->setHdlr("another e1", [&hdlrIDs](){ hdlrIDs.insert(3); }))  << "REQ: reuse e1.";
     PARA_DOM->forceAllHdlr("another e1");
     EXPECT_NE(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("e2")) << "REQ: rm ev not impact its alias.";
-    EXPECT_EQ(3u, MSG_SELF->nMsg()) << "REQ: another e1's hdlr is on road.";
+    EXPECT_EQ(2u, MSG_SELF->nMsg()) << "REQ: another e1's hdlr is on road.";
 
     EXPECT_TRUE(PARA_DOM->rmEvOK("e2")) << "REQ: can rm alias Ev.";
     this->pongMsgSelf_();
@@ -317,7 +317,7 @@ TYPED_TEST_P(RmFreeHdlrDomTest, GOLD_rm_FreeHdlrDom_resrc)
 REGISTER_TYPED_TEST_SUITE_P(RmFreeHdlrDomTest
     , GOLD_rm_FreeHdlrDom_resrc
 );
-using AnyRmFreeHdlrDom = Types<MaxDom>;
+using AnyRmFreeHdlrDom = Types<MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, RmFreeHdlrDomTest, AnyRmFreeHdlrDom);
 
 #define RM_PRI_DOM
@@ -340,7 +340,7 @@ TYPED_TEST_P(RmPriDomTest, GOLD_rm_PriDom_resrc)
 REGISTER_TYPED_TEST_SUITE_P(RmPriDomTest
     , GOLD_rm_PriDom_resrc
 );
-using AnyRmPriDom = Types<MaxNofreeDom, MaxDom>;
+using AnyRmPriDom = Types<MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, RmPriDomTest, AnyRmPriDom);
 
 #define RM_M_HDLR_DOM
@@ -355,7 +355,7 @@ TYPED_TEST_P(RmMhdlrDomTest, GOLD_rm_MhdlrDom_resrc)
     PARA_DOM->multiHdlrOnSameEv("e1", [&hdlrIDs](){ hdlrIDs.insert(2); }, "h2");
 
     PARA_DOM->setState({{"e1", true}});
-    EXPECT_EQ(2u, MSG_SELF->nMsg()) << "REQ: 2 hdlrs on road.";
+    EXPECT_EQ(1u, MSG_SELF->nMsg()) << "REQ: 2 hdlrs on road (in 1 batch msg).";
     EXPECT_EQ(0u, hdlrIDs.size()) << "REQ: not callback yet.";
 
     EXPECT_TRUE(PARA_DOM->rmEvOK("e1"));
@@ -371,7 +371,7 @@ TYPED_TEST_P(RmMhdlrDomTest, GOLD_rm_MhdlrDom_resrc)
 REGISTER_TYPED_TEST_SUITE_P(RmMhdlrDomTest
     , GOLD_rm_MhdlrDom_resrc
 );
-using AnyRmMhdlrDom = Types<MaxNofreeDom, MaxDom>;
+using AnyRmMhdlrDom = Types<MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, RmMhdlrDomTest, AnyRmMhdlrDom);
 
 }  // namespace
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <chrono>
+#include <limits>
+
+#include "UtInitObjAnywhere.hpp"
+
+using namespace std;
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct StaticDomTest : public UtInitObjAnywhere
+{
+    // fan-out e0 -> leaf0..leafN-1, each leaf w/ repeated hdlr: 1 setState(e0=T) = 1 wave of N hdlr
+    template<class aDom> void setFanOut(aDom& aDom_, size_t aN)
+    {
+        aDom_.newEvent("e0");
+        for (size_t i = 0; i < aN; ++i)
+        {
+            const auto en = "leaf" + to_string(i);
+            aDom_.setPrev(en, {{"e0", true}});
+            aDom_.repeatedHdlr(en);
+            aDom_.setHdlr(en, [this]{ ++nHdlr_; });
+        }
+    }
+    template<class aDom> long long nsPerEv(aDom& aDom_, size_t aN, size_t aNWave)
+    {
+        traceOn_ = false;  // measure dispatch, not log
+        const auto t0 = chrono::steady_clock::now();
+        for (size_t i = 0; i < aNWave; ++i)
+        {
+            aDom_.setState({{"e0", true}});
+            aDom_.setState({{"e0", false}});
+        }
+        const auto t1 = chrono::steady_clock::now();
+        traceOn_ = true;
+        MSG_SELF->handleAllMsg();
+        return chrono::duration_cast<chrono::nanoseconds>(t1 - t0).count() / (aN * aNWave);
+    }
+
+    // -------------------------------------------------------------------------------------------
+    size_t nHdlr_ = 0;
+    vector<int> order_;
+};
+
+// ***********************************************************************************************
+TEST_F(StaticDomTest, GOLD_sameBehavior_asDynDom)
+{
+    StaticMaxDom dom(uniLogName());
+    dom.setPriority("e2", EMsgPri_HIGH);
+    dom.setHdlr("e1", [this]{ order_.push_back(1); });
+    dom.setHdlr("e2", [this]{ order_.push_back(2); });
+    dom.multiHdlrOnSameEv("e2", [this]{ order_.push_back(3); }, "h3");
+    dom.setState({{"e1", true}, {"e2", true}});
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ((vector<int>{2, 3, 1}), order_) << "REQ: pri & multi hdlr via static call";
+
+    dom.setState({{"e1", false}, {"e2", false}});
+    dom.setState({{"e1", true}, {"e2", true}});
+    MSG_SELF->handleAllMsg();
+    EXPECT_EQ(3u, order_.size()) << "REQ: FreeHdlrDom rm non-repeat hdlr after called";
+}
+
+// ***********************************************************************************************
+TEST_F(StaticDomTest, GOLD_perf_dispatch)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N      = 1'000;
+    constexpr size_t N_WAVE = 200;
+    StaticMaxDom staticDom(uniLogName());
+    MaxDom dynDom(uniLogName());
+    setFanOut(staticDom, N);
+    setFanOut(dynDom, N);
+
+    auto nsStatic = numeric_limits<long long>::max();
+    auto nsDyn = nsStatic;
+    for (int round = 0; round < 5; ++round)  // min of interleaved rounds: less noise
+    {
+        nsStatic = min(nsStatic, nsPerEv(staticDom, N, N_WAVE));
+        nsDyn    = min(nsDyn,    nsPerEv(dynDom,    N, N_WAVE));
+    }
+    EXPECT_EQ(5 * 2 * N * N_WAVE, nHdlr_) << "REQ: each wave triggers all hdlrs";
+
+    // REQ: static composition saves dispatch per ev (loose: full ut run noise is +-7% of a whole wave)
+    // - per ev w/ hdlr: dyn has 3 virtual calls (effect_, triggerHdlr_, getPriority), static 0
+    // - measured (TRC off, 1000 ev/wave, min of 5 rounds):
+    //   . -O3: static ~94ns vs dyn ~97ns per ev: ~3ns saved = the 3 indirect calls
+    //   . -O1 (ut default): ~165ns both (+-1ns): little inline at -O1
+    //   . rest of a wave (deduce, attr lookup, batch push) dominates; static can't save it
+    EXPECT_LE(nsStatic * 4, nsDyn * 5) << "static=" << nsStatic << "ns/ev, dyn=" << nsDyn << "ns/ev";
+}
+
+}  // namespace
@@ -138,7 +138,7 @@ REGISTER_TYPED_TEST_SUITE_P(WbasicDatDomTest
     , setFlag_holeWorkWell
     , nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
-using AnyDatDom = Types<MinWbasicDatDom, MaxNofreeDom, MaxDom>;
+using AnyDatDom = Types<MinWbasicDatDom, MaxNofreeDom, MaxDom, StaticMaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, WbasicDatDomTest, AnyDatDom);
 
 }  // namespace
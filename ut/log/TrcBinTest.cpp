@@ -0,0 +1,218 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#define IN_GTEST
+#include "UniCoutLog.hpp"
+#undef IN_GTEST
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <thread>
+
+using namespace std;
+using namespace testing;
+
+namespace rlib
+{
+// ***********************************************************************************************
+// minimal decoder to verify file format (full decoder: tools/dom_gantt.py)
+struct TrcBinRec
+{
+    string fmt;
+    int64_t tsNs;
+    string args;  // tag + text per arg, eg "s:e1,c:T,"
+};
+
+struct TrcBinTest : public Test
+{
+    ~TrcBinTest()
+    {
+        EXPECT_TRUE(TrcBin::setFileOK(""));
+        remove(fileName_);
+    }
+
+    template<class T> T get(size_t& aPos)
+    {
+        T val;
+        memcpy(&val, data_.data() + aPos, sizeof(val));
+        aPos += sizeof(val);
+        return val;
+    }
+
+    vector<TrcBinRec> decode()
+    {
+        TrcBin::mt_flush();
+        ifstream fin(fileName_, ios::binary);
+        data_.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+        vector<TrcBinRec> recs;
+        nFmtRec_ = 0;
+        if (data_.size() < 12 || memcmp(data_.data(), TrcBin::MAGIC, 8) != 0)
+            return recs;
+
+        size_t pos = 8;
+        EXPECT_EQ(TrcBin::ENDIAN_MARK, get<uint32_t>(pos));
+        map<uint32_t, string> id_fmt;
+        while (pos < data_.size())
+        {
+            const char kind = data_[pos++];
+            const auto id = get<uint32_t>(pos);
+            if (kind == 'F')
+            {
+                const auto len = get<uint16_t>(pos);
+                id_fmt[id] = data_.substr(pos, len);
+                pos += len;
+                ++nFmtRec_;
+                continue;
+            }
+            EXPECT_EQ('R', kind);
+            EXPECT_EQ(1u, id_fmt.count(id)) << "REQ: fmt rec before its log rec";
+            TrcBinRec rec{id_fmt[id], get<int64_t>(pos), ""};
+            for (auto nArg = uint8_t(data_[pos++]); nArg > 0; --nArg)
+            {
+                const char tag = data_[pos++];
+                rec.args += tag;
+                rec.args += ':';
+                switch (tag)
+                {
+                case 's': { const auto len = uint8_t(data_[pos++]); rec.args += data_.substr(pos, len); pos += len; break; }
+                case 'c': rec.args += data_[pos++]; break;
+                case 'i': rec.args += to_string(get<int64_t>(pos)); break;
+                case 'u': rec.args += to_string(get<uint64_t>(pos)); break;
+                case 'd': rec.args += to_string(get<double>(pos)); break;
+                default : rec.args += "0x" + to_string(get<uint64_t>(pos)); break;
+                }
+                rec.args += ',';
+            }
+            recs.push_back(rec);
+        }
+        return recs;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    const char* fileName_ = "ut_trc_bin.bin";
+    string data_;
+    size_t nFmtRec_ = 0;
+};
+
+#define BIN
+// ***********************************************************************************************
+TEST_F(TrcBinTest, GOLD_TRC_toBin_and_decode)
+{
+    ASSERT_TRUE(TrcBin::setFileOK(fileName_));
+    ASSERT_TRUE(TrcBin::mt_on());
+
+    const auto t0 = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
+    for (int i = 0; i < 3; ++i)
+        TRC("(Domino) %s=%c", (i ? "e2" : "e1"), 'T');
+    TRC("n=%zu i=%d f=%.1f", size_t(7), -3, 0.5);
+
+    const auto recs = decode();
+    ASSERT_EQ(4u, recs.size());
+    EXPECT_EQ(2u, nFmtRec_) << "REQ: fmt once per TRC call site, not per call";
+    EXPECT_EQ("(Domino) %s=%c", recs[0].fmt);
+    EXPECT_EQ("s:e1,c:T,", recs[0].args) << "REQ: raw args";
+    EXPECT_EQ("s:e2,c:T,", recs[2].args);
+    EXPECT_EQ("n=%zu i=%d f=%.1f", recs[3].fmt);
+    EXPECT_EQ("u:7,i:-3,d:0.500000,", recs[3].args);
+    EXPECT_LE(t0, recs[0].tsNs) << "REQ: raw wall-clock ns";
+    EXPECT_LE(recs[0].tsNs, recs[3].tsNs);
+}
+TEST_F(TrcBinTest, longStr_truncated)
+{
+    ASSERT_TRUE(TrcBin::setFileOK(fileName_));
+    const string longMsg(300, 'Z');
+    TRC("%s", longMsg.c_str());
+
+    const auto recs = decode();
+    ASSERT_EQ(1u, recs.size());
+    EXPECT_EQ("s:" + string(TrcBin::MAX_STR, 'Z') + ",", recs[0].args) << "REQ: truncate like text TRC";
+}
+TEST_F(TrcBinTest, newFile_hasAllFmt)
+{
+    ASSERT_TRUE(TrcBin::setFileOK(fileName_));
+    for (int i = 0; i < 2; ++i)
+    {
+        if (i == 1)
+        {
+            ASSERT_TRUE(TrcBin::setFileOK(fileName_));  // REQ: fmt registered in old file shall be in new
+        }
+        TRC("i=%d", i);
+    }
+    const auto recs = decode();
+    ASSERT_EQ(1u, recs.size());
+    EXPECT_EQ("i:1,", recs[0].args);
+}
+TEST_F(TrcBinTest, off_or_badFile_backToText)
+{
+    EXPECT_FALSE(TrcBin::mt_on()) << "REQ: default text TRC";
+    EXPECT_FALSE(TrcBin::setFileOK("/nonexistent_dir_12345/impossible.bin"));
+    EXPECT_FALSE(TrcBin::mt_on()) << "REQ: bad file keeps text TRC";
+
+    ASSERT_TRUE(TrcBin::setFileOK(fileName_));
+    ASSERT_TRUE(TrcBin::setFileOK(""));
+    EXPECT_FALSE(TrcBin::mt_on());
+}
+
+#define MT
+// ***********************************************************************************************
+TEST_F(TrcBinTest, GOLD_multiThread_noLoss)
+{
+    ASSERT_TRUE(TrcBin::setFileOK(fileName_));
+    constexpr int N = 1000;
+    auto trcN = [](char aTh) {
+        for (int i = 0; i < N; ++i)
+            TRC("th=%c i=%d", aTh, i);
+    };
+    thread th1(trcN, '1');
+    thread th2(trcN, '2');
+    th1.join();  // REQ: thread exit flushes its buf
+    th2.join();
+
+    size_t nTh1 = 0;
+    for (auto&& rec : decode())
+        nTh1 += (rec.args[2] == '1');
+    EXPECT_EQ(size_t(N), nTh1);
+    EXPECT_EQ(size_t(2 * N), decode().size());
+}
+
+#define PERF
+// ***********************************************************************************************
+TEST_F(TrcBinTest, GOLD_perf_vsText)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N = 300'000;  // = nTRC of GOLD_perf_mem
+    const string en = "long_ev_name_xxxxxxxxx#12345";
+    using Clock = chrono::steady_clock;
+    auto trcN = [&en]() {
+        const auto t0 = Clock::now();
+        for (size_t i = 0; i < N; ++i)
+            TRC("(Domino) %s=%c", en.c_str(), (i & 1) ? 'T' : 'F');
+        return chrono::duration_cast<chrono::microseconds>(Clock::now() - t0).count();
+    };
+
+    const char* txtFile = "ut_trc_txt.log";
+    ASSERT_TRUE(UniCoutLog::setLogFileOK(txtFile));
+    const auto usTxt = trcN();
+    UniCoutLog::dumpAll_forUt();
+    remove(txtFile);
+
+    ASSERT_TRUE(TrcBin::setFileOK(fileName_));
+    const auto usBin = trcN();
+    TrcBin::mt_flush();
+
+    // REQ: binary TRC costs a small fraction of text TRC
+    // - text ~300ns/call (timestamp + snprintf + fwrite); binary ~30ns (clock + memcpy)
+    EXPECT_LE(usBin * 3, usTxt) << "bin=" << usBin << "us, txt=" << usTxt << "us for " << N << " TRC";
+}
+
+}  // namespace
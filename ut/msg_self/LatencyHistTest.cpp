@@ -0,0 +1,127 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "LatencyHist.hpp"
+#include "MsgSelf.hpp"
+#include "MsgSelfStatsCost.hpp"
+#include "UniLog.hpp"
+
+using namespace std;
+using namespace std::chrono;
+using namespace testing;
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct LatencyHistTest : public Test, public UniLog
+{
+    LatencyHistTest() : UniLog(UnitTest::GetInstance()->current_test_info()->name()) {}
+    ~LatencyHistTest() { GTEST_LOG_FAIL }
+
+    LatencyHist hist_;
+};
+
+// ***********************************************************************************************
+TEST_F(LatencyHistTest, GOLD_bucket_logLinear_25pctErr)
+{
+    for (uint64_t val : initializer_list<uint64_t>{0, 1, 3, 4, 7, 8, 1'000, 123'456'789, UINT64_MAX})
+    {
+        const auto bucket = LatencyHist::idx(val);
+        EXPECT_LT(bucket, LatencyHist::N_BUCKET);
+        EXPECT_GE(LatencyHist::upper(bucket), val) << "REQ: val in its bucket";
+        if (bucket > 0)
+        {
+            EXPECT_LT(LatencyHist::upper(bucket - 1), val) << "REQ: not in prev bucket";
+        }
+        EXPECT_LE(LatencyHist::upper(bucket) - val, val / 4) << "REQ: <= 25% err";
+    }
+    EXPECT_EQ(LatencyHist::N_BUCKET - 1, LatencyHist::idx(UINT64_MAX)) << "REQ: full range";
+}
+
+// ***********************************************************************************************
+TEST_F(LatencyHistTest, GOLD_percentile_max_reset)
+{
+    EXPECT_EQ(0u, hist_.percentile(99)) << "REQ: empty";
+
+    for (uint64_t val = 1; val <= 100; ++val)
+        hist_.add(val * 10);
+    hist_.add(100'000);  // 1 outlier
+    EXPECT_EQ(101u, hist_.n());
+    EXPECT_EQ(100'000u, hist_.max());
+
+    const auto p50 = hist_.percentile(50);
+    EXPECT_GE(p50, 500u);
+    EXPECT_LE(p50, 500u * 5 / 4) << "REQ: <= 25% err";
+    EXPECT_LE(hist_.percentile(99), 1'000u * 5 / 4) << "REQ: outlier above p99";
+    EXPECT_EQ(100'000u, hist_.percentile(100)) << "REQ: capped by max";
+
+    hist_.reset();
+    EXPECT_EQ(0u, hist_.n());
+    EXPECT_EQ(0u, hist_.max());
+}
+
+// ***********************************************************************************************
+TEST_F(LatencyHistTest, GOLD_perf_stampAndAdd)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N = 1'000'000;
+    LatencyHist run;
+    uint64_t last = 0;
+    auto t0 = steady_clock::now();
+    for (size_t i = 0; i < N; ++i)  // as MsgSelf per sampled msg: 3 stamp, 2 add
+    {
+        const auto enq   = statTick();
+        const auto start = statTick();
+        hist_.add(start - enq);
+        const auto end = statTick();
+        run.add(end - start + (last & 1));
+        last = end;
+    }
+    auto t1 = steady_clock::now();
+
+    const auto ns = duration_cast<nanoseconds>(t1 - t0).count() / N;
+    EXPECT_LT(ns, 200) << "REQ: cheap per msg";
+    // measured (-O1, VM): ~55ns per sampled msg, dominated by rdtsc (~18ns each in this VM)
+    //   . so MsgSelf samples 1 per MSG_SELF_STATS msg: eg 16 -> a few ns per msg on average
+}
+
+// ***********************************************************************************************
+TEST_F(LatencyHistTest, GOLD_perf_msgSelf_statsOverhead)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N_BURST = 1'000;
+    constexpr size_t N_ROUND = 500;
+    auto nsNoStats = numeric_limits<long long>::max();
+    auto nsStats16 = nsNoStats;
+    auto nsAsBuilt = nsNoStats;
+    for (int round = 0; round < 5; ++round)  // min of interleaved rounds: less noise
+    {
+        nsNoStats = min(nsNoStats, nsPerMsg_noStats(N_BURST, N_ROUND));
+        nsStats16 = min(nsStats16, nsPerMsg_stats16(N_BURST, N_ROUND));
+        nsAsBuilt = min(nsAsBuilt, nsPerMsg<MsgSelf>(N_BURST, N_ROUND));
+    }
+    ASSERT_GT(nsNoStats, 0) << "REQ: all msg handled";
+    ASSERT_GT(nsStats16, 0) << "REQ: all msg handled";
+
+    // REQ: end-to-end (newMsgOK + dispatch) overhead of opt-in stats well under 20ns per msg
+    // - measured (-O1, VM, min of 5) per msg: compiled out ~35-44ns, MSG_SELF_STATS=16 +6~17ns,
+    //   =1 (as ut) ~100ns
+    //   . =16: rdtsc amortized (~4ns) + per msg sample check, maxDepth_ & 8B more per queued msg
+    //   . =1 samples every msg: 3 rdtsc (~18ns each in this VM); for ut/debug, not for perf build
+    EXPECT_LT(nsStats16, nsNoStats + 20) << "stats=16: " << nsStats16 << "ns, compiled out: " << nsNoStats
+        << "ns, as built: " << nsAsBuilt << "ns per msg";
+}
+
+}  // namespace
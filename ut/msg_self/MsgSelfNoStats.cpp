@@ -0,0 +1,23 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - MsgSelf as default build (MSG_SELF_STATS compiled out), as own class in this TU only
+//   . so no ODR clash w/ lib's MsgSelf (eg MSG_SELF_STATS=1 in ut)
+// ***********************************************************************************************
+#undef  MSG_SELF_STATS
+#define MsgSelf MsgSelf_noStats
+#include "MsgSelf.cpp"
+#undef  MsgSelf
+
+#include "MsgSelfStatsCost.hpp"
+
+namespace rlib
+{
+long long nsPerMsg_noStats(const size_t aNBurst, const size_t aNRound) noexcept
+{
+    return nsPerMsg<MsgSelf_noStats>(aNBurst, aNRound);
+}
+}  // namespace
@@ -0,0 +1,24 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - MsgSelf w/ MSG_SELF_STATS=16 (typical opt-in: sample 1 per 16 msg), as own class in this TU only
+//   . so no ODR clash w/ lib's MsgSelf (eg MSG_SELF_STATS=1 in ut)
+// ***********************************************************************************************
+#undef  MSG_SELF_STATS
+#define MSG_SELF_STATS 16
+#define MsgSelf MsgSelf_stats16
+#include "MsgSelf.cpp"
+#undef  MsgSelf
+
+#include "MsgSelfStatsCost.hpp"
+
+namespace rlib
+{
+long long nsPerMsg_stats16(const size_t aNBurst, const size_t aNRound) noexcept
+{
+    return nsPerMsg<MsgSelf_stats16>(aNBurst, aNRound);
+}
+}  // namespace
@@ -0,0 +1,42 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - same end-to-end loop on MsgSelf compiled w/ diff MSG_SELF_STATS, so 1 ut measures the delta
+//   . each variant TU (MsgSelfNoStats.cpp/MsgSelfStats16.cpp) compiles MsgSelf.cpp as its own class
+// ***********************************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace rlib
+{
+// ***********************************************************************************************
+// - newMsgOK() + handleAllMsg() per msg, in bursts (as a busy main loop)
+template<class aMsgSelf>
+long long nsPerMsg(const size_t aNBurst, const size_t aNRound) noexcept
+{
+    aMsgSelf msgSelf("statsCost");
+    size_t nCalled = 0;
+    const auto msg = [&nCalled]() noexcept { ++nCalled; };  // 8B: inline in queue, no heap
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < aNRound; ++r)
+    {
+        for (size_t i = 0; i < aNBurst; ++i)
+            (void)msgSelf.newMsgOK(msg);
+        msgSelf.handleAllMsg();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return nCalled == aNBurst * aNRound
+        ? std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (aNBurst * aNRound)
+        : -1;  // lost msg: caller fails
+}
+
+long long nsPerMsg_noStats(const size_t aNBurst, const size_t aNRound) noexcept;
+long long nsPerMsg_stats16(const size_t aNBurst, const size_t aNRound) noexcept;
+
+}  // namespace
@@ -4,13 +4,18 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 // ***********************************************************************************************
+#include <atomic>
 #include <chrono>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <deque>
 #include <memory>  // for shared_ptr
+#include <numeric>
 #include <queue>
+#include <thread>
 
 #include "MsgSelf.hpp"
+#include "MtInQueue.hpp"
 #include "MT_PingMainTH.hpp"
 
 using namespace std;
@@ -127,6 +132,24 @@ TEST_F(MsgSelfTest, newHighPri_first)
     msgSelf_->handleAllMsg();
     EXPECT_EQ(queue<int>({5, 4, 2, 1, 3}), hdlrIDs_);
 }
+TEST_F(MsgSelfTest, GOLD_anyNofPri_highestFirst_shallYield)  // any MSG_PRI_N
+{
+    for (int pri = EMsgPri_NORM; pri < EMsgPri_MAX; ++pri)  // low pri is 1/round
+        EXPECT_TRUE(msgSelf_->newMsgOK([this, pri]{ hdlrIDs_.push(pri); }, EMsgPriority(pri))) << "REQ: new msg OK";
+    EXPECT_TRUE(msgSelf_->newMsgOK([this]{ hdlrIDs_.push(EMsgPri_HIGH); }, EMsgPri_HIGH)) << "REQ: new msg OK";
+
+    EXPECT_FALSE(msgSelf_->shallYield(EMsgPri_HIGH)) << "REQ: nothing higher";
+    EXPECT_TRUE (msgSelf_->shallYield(EMsgPri_NORM)) << "REQ: higher exists";
+    EXPECT_TRUE (msgSelf_->shallYield(EMsgPri_LOW))  << "REQ: low always yields";
+    EXPECT_FALSE(msgSelf_->shallYield(EMsgPri_MAX))  << "REQ: invalid pri";
+
+    msgSelf_->handleAllMsg();
+    queue<int> expected({EMsgPri_HIGH});
+    for (int pri = EMsgPri_MAX - 1; pri >= EMsgPri_NORM; --pri)
+        expected.push(pri);
+    EXPECT_EQ(expected, hdlrIDs_) << "REQ: pri then FIFO";
+    EXPECT_FALSE(msgSelf_->shallYield(EMsgPri_NORM)) << "REQ: bitmap cleared as queues emptied";
+}
 TEST_F(MsgSelfTest, newLowPri_inNormHandler_handledSameRound)
 {
     // the low-pri yield triggers only AFTER a LOW msg runs; so a LOW created while handling a
@@ -161,6 +184,87 @@ TEST_F(MsgSelfTest, newLowPri_inLowHandler_deferred_toNextHandleAll)
     EXPECT_EQ(queue<int>({20, 1}), hdlrIDs_)     << "REQ: deferred low handled next round";
     EXPECT_EQ(0u, msgSelf_->nMsg(EMsgPri_LOW));
 }
+TEST_F(MsgSelfTest, GOLD_lowPriQuota_1lowPerNHigher_noStarve)
+{
+    auto sendAll = [this]
+    {
+        for (int i = 0; i < 2; ++i)
+            EXPECT_TRUE(msgSelf_->newMsgOK(d1MsgHdlr_, EMsgPri_LOW));
+        for (int i = 0; i < 5; ++i)
+            EXPECT_TRUE(msgSelf_->newMsgOK(d2MsgHdlr_));
+    };
+    sendAll();
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({2, 2, 2, 2, 2, 1}), hdlrIDs_) << "REQ: default strict priority";
+    msgSelf_->handleAllMsg();
+    hdlrIDs_ = queue<int>();
+
+    msgSelf_->setLowPriQuota(2);
+    sendAll();
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({2, 2, 1, 2, 2, 1, 2}), hdlrIDs_) << "REQ: 1 low per 2 higher, same round";
+    EXPECT_EQ(0u, msgSelf_->nMsg());
+}
+TEST_F(MsgSelfTest, lowPriQuota_noCreditWhenLowEmpty_stillOneLowPerRoundAlone)
+{
+    msgSelf_->setLowPriQuota(2);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_TRUE(msgSelf_->newMsgOK(d2MsgHdlr_));
+    msgSelf_->handleAllMsg();  // no low waiting: no credit saved
+    for (int i = 0; i < 2; ++i)
+        EXPECT_TRUE(msgSelf_->newMsgOK(d1MsgHdlr_, EMsgPri_LOW));
+    EXPECT_TRUE(msgSelf_->newMsgOK(d2MsgHdlr_));
+    hdlrIDs_ = queue<int>();
+
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({2, 1}), hdlrIDs_) << "REQ: higher 1st; low alone still 1 per round";
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({2, 1, 1}), hdlrIDs_);
+}
+#if MSG_SELF_STATS
+TEST_F(MsgSelfTest, GOLD_perf_overload_tailLatencyPerPri)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    // - synthetic overload: per main-loop round 1 high + 20 norm + 1 low arrive, only 16 handled
+    constexpr size_t N_ROUND = 2'000;
+    constexpr size_t N_NORM  = 20;
+    constexpr size_t N_HANDLE = 16;
+    volatile size_t work = 0;
+    auto msg = [&work]{ for (int i = 0; i < 50; ++i) work = work + 1; };  // ~tens ns
+    auto run = [&](const size_t aQuota)
+    {
+        auto msgSelf = make_shared<MsgSelf>(uniLogName());
+        msgSelf->setLowPriQuota(aQuota);
+        for (size_t r = 0; r < N_ROUND; ++r)
+        {
+            EXPECT_TRUE(msgSelf->newMsgOK(msg, EMsgPri_HIGH));
+            for (size_t i = 0; i < N_NORM; ++i)
+                EXPECT_TRUE(msgSelf->newMsgOK(msg));
+            EXPECT_TRUE(msgSelf->newMsgOK(msg, EMsgPri_LOW));
+            msgSelf->handleNMsg(N_HANDLE);
+        }
+        const auto stats = msgSelf->stats();
+        const auto nLowLeft = msgSelf->nMsg(EMsgPri_LOW);
+        while (msgSelf->nMsg())  // rest: not in measure
+            msgSelf->handleAllMsg();
+        return make_pair(nLowLeft, stats);
+    };
+    const auto [nLowStrict, strict] = run(0);
+    const auto [nLowQuota,  quota]  = run(8);
+
+    EXPECT_EQ(0u, strict.pri_[EMsgPri_LOW].queue_.n()) << "REQ: strict starves low";
+    EXPECT_EQ(N_ROUND, nLowStrict) << "REQ: & its queue grows unbounded";
+    EXPECT_GT(quota.pri_[EMsgPri_LOW].queue_.n(), N_ROUND / 2) << "REQ: quota serves low";
+    EXPECT_LT(nLowQuota, 10u) << "REQ: low queue bounded";
+    EXPECT_LT(quota.pri_[EMsgPri_HIGH].queue_.percentile(99), 2 * strict.pri_[EMsgPri_HIGH].queue_.percentile(99) + 1'000)
+        << "REQ: high pri barely affected";
+    // measured (-O1, as ut) queueing delay p99 / max:
+    //   . strict:  high ~2.4us / ~0.9ms (1st ring growth), norm ~2.7ms (backlog grows), low never run (2000 queued)
+    //   . quota=8: high ~2.0us / ~0.8ms, norm ~2.7ms, low ~1.7us / ~10-45us (0 left)
+}
+#endif
 
 #define DESTRUCT_MSGSELF
 // ***********************************************************************************************
@@ -187,6 +291,503 @@ TEST_F(MsgSelfTest, wait_notify)
     msgSelf_->handleAllMsg();  // clear msg queue
 }
 
+#define BUDGET
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_handleNMsg_stopAtBudget_highPriFirst_ping)
+{
+    for (int i = 0; i < 5; ++i)
+        EXPECT_TRUE(msgSelf_->newMsgOK(d1MsgHdlr_)) << "REQ: new msg OK";
+    timedwait(0, 0);  // consume above pings
+
+    auto start = high_resolution_clock::now();
+    EXPECT_EQ(2u, msgSelf_->handleNMsg(2)) << "REQ: stop at budget";
+    EXPECT_EQ(3u, msgSelf_->nMsg(EMsgPri_NORM));
+    timedwait(0, 100'000'000);
+    EXPECT_LT(duration_cast<milliseconds>(high_resolution_clock::now() - start).count(), 100)
+        << "REQ: rest msg re-ping main thread";
+
+    EXPECT_TRUE(msgSelf_->newMsgOK(d2MsgHdlr_, EMsgPri_HIGH)) << "REQ: new msg OK";  // mid-burst
+    EXPECT_EQ(1u, msgSelf_->handleNMsg(1));
+    EXPECT_EQ(queue<int>({1, 1, 2}), hdlrIDs_) << "REQ: high pri 1st";
+
+    EXPECT_EQ(3u, msgSelf_->handleNMsg(100)) << "REQ: stop at empty";
+    EXPECT_EQ(0u, msgSelf_->handleNMsg(100));
+    EXPECT_EQ(0u, msgSelf_->handleNMsg(0));
+}
+TEST_F(MsgSelfTest, handleMsgFor_stopAtTime_butAtLeast1)
+{
+    MsgCB slow = [&]()
+    {
+        hdlrIDs_.push(7);
+        this_thread::sleep_for(milliseconds(2));
+    };
+    for (int i = 0; i < 5; ++i)
+        EXPECT_TRUE(msgSelf_->newMsgOK(slow)) << "REQ: new msg OK";
+    EXPECT_TRUE(msgSelf_->newMsgOK(d1MsgHdlr_, EMsgPri_LOW)) << "REQ: new msg OK";
+    EXPECT_TRUE(msgSelf_->newMsgOK(d1MsgHdlr_, EMsgPri_LOW)) << "REQ: new msg OK";
+
+    EXPECT_EQ(1u, msgSelf_->handleMsgFor(0ns)) << "REQ: at least 1 msg, always progress";
+    const auto nHandled = msgSelf_->handleMsgFor(3ms);
+    EXPECT_GE(nHandled, 1u);
+    EXPECT_LE(nHandled, 3u) << "REQ: stop at budget (each msg 2ms)";
+
+    EXPECT_EQ(4u - nHandled + 1, msgSelf_->handleMsgFor(1s)) << "REQ: rest norm + low pri still 1/round";
+    EXPECT_EQ(1u, msgSelf_->nMsg(EMsgPri_LOW));
+    EXPECT_EQ(1u, msgSelf_->handleMsgFor(1s));
+    EXPECT_EQ(0u, msgSelf_->nMsg());
+}
+
+#define STATS
+#if MSG_SELF_STATS
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_stats_queueDelay_runtime_maxDepth)
+{
+    MsgCB slow = [&]()
+    {
+        hdlrIDs_.push(7);
+        this_thread::sleep_for(milliseconds(2));
+    };
+    EXPECT_TRUE(msgSelf_->newMsgOK(slow)) << "REQ: new msg OK";
+    EXPECT_TRUE(msgSelf_->newMsgOK(d1MsgHdlr_)) << "REQ: new msg OK";  // queued behind slow
+    EXPECT_TRUE(msgSelf_->newMsgOK(d2MsgHdlr_, EMsgPri_HIGH)) << "REQ: new msg OK";
+    msgSelf_->handleAllMsg();
+
+    const auto stats = msgSelf_->stats();
+    auto&& norm = stats.pri_[EMsgPri_NORM];
+    EXPECT_EQ(2u, norm.queue_.n());
+    EXPECT_EQ(2u, norm.run_.n());
+    EXPECT_EQ(2u, norm.maxDepth_);
+    EXPECT_GE(stats.ns(norm.run_.max()),   1'000'000u) << "REQ: slow's runtime (~2ms)";
+    EXPECT_GE(stats.ns(norm.queue_.max()), 1'000'000u) << "REQ: d1 waited for slow";
+    EXPECT_LT(stats.ns(norm.queue_.max()), 1'000'000'000u);
+    EXPECT_EQ(1u, stats.pri_[EMsgPri_HIGH].run_.n());
+    EXPECT_EQ(1u, stats.pri_[EMsgPri_HIGH].maxDepth_);
+    EXPECT_EQ(0u, stats.pri_[EMsgPri_LOW].run_.n());
+
+    msgSelf_->resetStats();
+    EXPECT_EQ(0u, msgSelf_->stats().pri_[EMsgPri_NORM].run_.n()) << "REQ: reset";
+    EXPECT_EQ(0u, msgSelf_->stats().pri_[EMsgPri_NORM].maxDepth_);
+}
+#endif
+
+#define MT_NEW_MSG
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_mtNewMsg_fromWorkers_fifoPerThread)
+{
+    constexpr size_t N_TH  = 4;
+    constexpr size_t N_MSG = 1'000;
+    vector<vector<size_t>> got(N_TH);  // main thread only
+    atomic<size_t> nNok(0);
+    vector<thread> workers;
+    for (size_t th = 0; th < N_TH; ++th)
+        workers.emplace_back([this, &got, &nNok, th]
+        {
+            for (size_t i = 0; i < N_MSG; ++i)
+                if (! msgSelf_->mt_newMsgOK([&got, th, i]{ got[th].push_back(i); }))
+                    ++nNok;
+        });
+
+    size_t nGot = 0;
+    for (int round = 0; nGot < N_TH * N_MSG && round < 10'000; ++round)  // main loop while pushing
+    {
+        timedwait(0, 1'000'000);
+        msgSelf_->handleNMsg(100);
+        nGot = 0;
+        for (auto&& one : got)
+            nGot += one.size();
+    }
+    for (auto&& worker : workers)
+        worker.join();
+    msgSelf_->handleAllMsg();
+
+    EXPECT_EQ(0u, nNok);
+    vector<size_t> expected(N_MSG);
+    iota(expected.begin(), expected.end(), 0);
+    for (auto&& one : got)
+        EXPECT_EQ(expected, one) << "REQ: all msg, FIFO per producer";
+}
+TEST_F(MsgSelfTest, mtNewMsg_mergedByPri_nokInvalid)
+{
+    thread([this]
+    {
+        EXPECT_TRUE(msgSelf_->mt_newMsgOK(d1MsgHdlr_));
+        EXPECT_TRUE(msgSelf_->mt_newMsgOK(d2MsgHdlr_, EMsgPri_HIGH));
+        EXPECT_FALSE(msgSelf_->mt_newMsgOK(nullptr)) << "REQ: NOK null";
+        EXPECT_FALSE(msgSelf_->mt_newMsgOK(d1MsgHdlr_, EMsgPri_MAX)) << "REQ: NOK priority";
+    }).join();
+    EXPECT_EQ(0u, msgSelf_->nMsg()) << "REQ: merged at handleXxx() only";
+
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({2, 1}), hdlrIDs_) << "REQ: as newMsgOK() once merged";
+
+    EXPECT_TRUE(msgSelf_->mt_newMsgOK(d3MsgHdlr_)) << "REQ: main thread can call too";
+    msgSelf_.reset();  // REQ: unmerged msg freed (no leak)
+}
+TEST_F(MsgSelfTest, GOLD_perf_mtNewMsg_vsMtInQueue)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N_TH = 4;
+    constexpr size_t N    = 100'000;
+    size_t nCalled = 0;
+    auto producers = [](auto&& aPush)
+    {
+        vector<thread> workers;
+        for (size_t th = 0; th < N_TH; ++th)
+            workers.emplace_back([&aPush]{ for (size_t i = 0; i < N / N_TH; ++i) aPush(); });
+        for (auto&& worker : workers)
+            worker.join();
+    };
+    MtInQueue mtQ;
+    EXPECT_TRUE(mtQ.setHdlrOK<size_t>([&nCalled](UniPtr aEle){ nCalled += *(STATIC_PTR_CAST<size_t>(aEle).get()); }));
+    for (size_t i = 0; i < N; ++i)  // warm: ring grown as a long-run main loop
+        EXPECT_TRUE(msgSelf_->newMsgOK([&nCalled]{ ++nCalled; }));
+    msgSelf_->handleAllMsg();
+
+    auto t0 = steady_clock::now();
+    producers([&mtQ]{ (void)mtQ.mt_pushOK(MAKE_PTR<size_t>(1)); });
+    auto t1 = steady_clock::now();
+    mtQ.handleAllEle();
+    auto t2 = steady_clock::now();
+    producers([this, &nCalled]{ (void)msgSelf_->mt_newMsgOK([&nCalled]{ ++nCalled; }); });
+    auto t3 = steady_clock::now();
+    msgSelf_->handleAllMsg();
+    auto t4 = steady_clock::now();
+    EXPECT_EQ(3 * N, nCalled);
+
+    const auto nsPushMtQ   = duration_cast<nanoseconds>(t1 - t0).count() / N;
+    const auto nsDrainMtQ  = duration_cast<nanoseconds>(t2 - t1).count() / N;
+    const auto nsPushSelf  = duration_cast<nanoseconds>(t3 - t2).count() / N;
+    const auto nsDrainSelf = duration_cast<nanoseconds>(t4 - t3).count() / N;
+    EXPECT_LT(nsPushSelf + nsDrainSelf, 2 * (nsPushMtQ + nsDrainMtQ)) << "REQ: same class at least"
+        << ", self=" << nsPushSelf << "+" << nsDrainSelf << "ns, mtQ=" << nsPushMtQ << "+" << nsDrainMtQ << "ns";
+    // - measured (-O1, 1 cpu so mutex never contended) per msg, push (worker) + drain (main):
+    //   . MtInQueue     ~115 + ~85ns (make_shared + mutex + deque + type_index)
+    //   . mt_newMsgOK   ~100 + ~60ns w/o MSG_SELF_STATS (node + xchg; drain = pop + into ring + run)
+    //   . mt_newMsgOK   ~130 + ~130ns as ut (MSG_SELF_STATS=1: 3 rdtsc per msg)
+    //   . push: both dominated by malloc + sem_post; lock-free gains when producers contend
+}
+
+#define CANCEL
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_cancelMsg_notRun_freedAtOnce)
+{
+    auto res = make_shared<int>(0);  // a resrc captured by msg
+    const auto token1 = msgSelf_->newCancelableMsg(d1MsgHdlr_);
+    const auto token2 = msgSelf_->newCancelableMsg([this, res]{ hdlrIDs_.push(2); });
+    const auto token3 = msgSelf_->newCancelableMsg(d3MsgHdlr_, EMsgPri_HIGH);
+    EXPECT_TRUE(token1 && token2 && token3) << "REQ: valid token";
+    EXPECT_EQ(2, res.use_count());
+
+    EXPECT_TRUE(msgSelf_->cancelMsgOK(token2)) << "REQ: cancel pending";
+    EXPECT_EQ(1, res.use_count()) << "REQ: captures freed at once, not at pop";
+    EXPECT_EQ(2u, msgSelf_->nMsg()) << "REQ: not counted";
+    EXPECT_EQ(1u, msgSelf_->nMsg(EMsgPri_NORM));
+
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({3, 1}), hdlrIDs_) << "REQ: cancelled not run, others as usual";
+    EXPECT_EQ(0u, msgSelf_->nMsg());
+}
+TEST_F(MsgSelfTest, cancelMsg_nok_twice_handled_invalid)
+{
+    const auto token1 = msgSelf_->newCancelableMsg(d1MsgHdlr_);
+    const auto token2 = msgSelf_->newCancelableMsg(d2MsgHdlr_);
+    EXPECT_TRUE(msgSelf_->cancelMsgOK(token1));
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(token1)) << "REQ: NOK twice";
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(token2 + 1)) << "REQ: NOK not yet sent";
+
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({2}), hdlrIDs_);
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(token2)) << "REQ: NOK handled";
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(token1)) << "REQ: NOK cancelled & dropped";
+
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(0)) << "REQ: NOK invalid token";
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(MsgToken(-1))) << "REQ: NOK invalid priority";
+    EXPECT_EQ(0u, msgSelf_->newCancelableMsg(nullptr)) << "REQ: NOK null";
+    EXPECT_EQ(0u, msgSelf_->newCancelableMsg(d1MsgHdlr_, EMsgPri_MAX)) << "REQ: NOK priority";
+}
+TEST_F(MsgSelfTest, cancelMsg_afterResume_stillRightMsg)
+{
+    const auto token1 = msgSelf_->newCancelableMsg(d1MsgHdlr_);
+    const auto token2 = msgSelf_->newCancelableMsg(d2MsgHdlr_);
+    EXPECT_TRUE(msgSelf_->resumeMsgOK(d4MsgHdlr_, EMsgPri_NORM));  // before all same pri
+
+    EXPECT_TRUE(msgSelf_->cancelMsgOK(token2)) << "REQ: resume not shift token";
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({4, 1}), hdlrIDs_);
+    EXPECT_FALSE(msgSelf_->cancelMsgOK(token1));
+}
+TEST_F(MsgSelfTest, GOLD_perf_cancel_vsWeakMsgCB)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N = 100'000;  // eg timeouts/requests mostly withdrawn before due
+    size_t nCalled = 0;
+    vector<SharedMsgCB> owners;
+    owners.reserve(N);
+    vector<MsgToken> tokens;
+    tokens.reserve(N);
+    for (size_t i = 0; i < N; ++i)  // warm: ring grown as a long-run main loop
+        EXPECT_TRUE(msgSelf_->newMsgOK([&nCalled]{ ++nCalled; }));
+    msgSelf_->handleAllMsg();
+
+    auto t0 = steady_clock::now();
+    for (size_t i = 0; i < N; ++i)  // old way: usr keeps SharedMsgCB, queued msg holds weak
+    {
+        owners.push_back(MAKE_PTR<MsgCB>([&nCalled]{ ++nCalled; }));
+        EXPECT_TRUE(msgSelf_->newMsgOK([weak = WeakMsgCB(owners.back())]{ if (auto cb = weak.lock()) (*cb.get())(); }));
+    }
+    for (size_t i = 0; i < N; ++i)
+        if (i % 10)  // cancel 90%
+            owners[i] = nullptr;
+    msgSelf_->handleAllMsg();
+    auto t1 = steady_clock::now();
+    for (size_t i = 0; i < N; ++i)
+        tokens.push_back(msgSelf_->newCancelableMsg([&nCalled]{ ++nCalled; }));
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (i % 10)
+        {
+            EXPECT_TRUE(msgSelf_->cancelMsgOK(tokens[i]));
+        }
+    }
+    msgSelf_->handleAllMsg();
+    auto t2 = steady_clock::now();
+    EXPECT_EQ(N + 2 * N / 10, nCalled);
+
+    const auto nsWeak  = duration_cast<nanoseconds>(t1 - t0).count() / N;
+    const auto nsToken = duration_cast<nanoseconds>(t2 - t1).count() / N;
+    EXPECT_LT(nsToken, nsWeak) << "REQ: faster, token=" << nsToken << "ns, weak=" << nsWeak << "ns";
+    // measured (-O1, as ut) per msg (new + 90% cancel + drain): token ~100ns, SharedMsgCB/WeakMsgCB ~220ns
+    //   . weak: 2 allocs (MsgCB + ctrl block) per msg, and dead msg still dispatched to find weak expired
+}
+
+#define TIMED_MSG
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_newMsgAfter_dueThenByPri_timedwaitWakeup)
+{
+    EXPECT_TRUE(msgSelf_->newMsgAfterOK(20ms, d1MsgHdlr_));
+    EXPECT_TRUE(msgSelf_->newMsgAfterOK(20ms, d2MsgHdlr_, EMsgPri_HIGH));
+    EXPECT_TRUE(msgSelf_->newMsgOK(d3MsgHdlr_));
+    EXPECT_EQ(2u, msgSelf_->nTimer());
+    EXPECT_EQ(1u, msgSelf_->nMsg()) << "REQ: not queued before due";
+
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({3}), hdlrIDs_);
+    this_thread::sleep_for(30ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({3, 2, 1}), hdlrIDs_) << "REQ: due msg as newMsgOK() (priority)";
+    EXPECT_EQ(0u, msgSelf_->nTimer());
+
+    const auto t0 = steady_clock::now();
+    EXPECT_TRUE(msgSelf_->newMsgAfterOK(30ms, d4MsgHdlr_));
+    while (hdlrIDs_.size() < 4 && steady_clock::now() - t0 < 3s)
+    {
+        msgSelf_->timedwait(1, 0);
+        msgSelf_->handleAllMsg();
+    }
+    const auto elapsed = steady_clock::now() - t0;
+    EXPECT_EQ(4, hdlrIDs_.back());
+    EXPECT_GE(elapsed, 30ms) << "REQ: not early";
+    EXPECT_LT(elapsed, 500ms) << "REQ: timedwait() returns by due, not 1s";
+}
+TEST_F(MsgSelfTest, GOLD_periodicMsg_untilCancel)
+{
+    const auto timer = msgSelf_->newPeriodicMsg(10ms, d1MsgHdlr_);
+    EXPECT_NE(0u, timer);
+    const auto t0 = steady_clock::now();
+    while (hdlrIDs_.size() < 3 && steady_clock::now() - t0 < 3s)
+    {
+        msgSelf_->timedwait(1, 0);
+        msgSelf_->handleAllMsg();
+    }
+    EXPECT_EQ(queue<int>({1, 1, 1}), hdlrIDs_) << "REQ: repeat";
+    EXPECT_GE(steady_clock::now() - t0, 30ms);
+    EXPECT_EQ(1u, msgSelf_->nTimer()) << "REQ: still armed";
+
+    EXPECT_TRUE(msgSelf_->cancelTimerOK(timer));
+    EXPECT_FALSE(msgSelf_->cancelTimerOK(timer)) << "REQ: NOK twice";
+    EXPECT_EQ(0u, msgSelf_->nTimer());
+    this_thread::sleep_for(20ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(3u, hdlrIDs_.size()) << "REQ: stopped";
+}
+TEST_F(MsgSelfTest, periodicMsg_mainLoopLate_skipMissed_noBurst)
+{
+    EXPECT_NE(0u, msgSelf_->newPeriodicMsg(5ms, d1MsgHdlr_));
+    this_thread::sleep_for(100ms);  // ~20 periods
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({1}), hdlrIDs_) << "REQ: 1 msg, not 20";
+
+    this_thread::sleep_for(10ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(2u, hdlrIDs_.size()) << "REQ: period continues";
+    msgSelf_.reset();  // REQ: pending timer freed (no leak)
+}
+TEST_F(MsgSelfTest, timedMsg_nokInvalid)
+{
+    EXPECT_FALSE(msgSelf_->newMsgAfterOK(1ms, nullptr)) << "REQ: NOK null";
+    EXPECT_FALSE(msgSelf_->newMsgAfterOK(1ms, d1MsgHdlr_, EMsgPri_MAX)) << "REQ: NOK priority";
+    EXPECT_FALSE(msgSelf_->newMsgAfterOK(-1ms, d1MsgHdlr_)) << "REQ: NOK negative";
+    EXPECT_EQ(0u, msgSelf_->newPeriodicMsg(0ms, d1MsgHdlr_)) << "REQ: NOK 0 period (busy loop)";
+    EXPECT_FALSE(msgSelf_->cancelTimerOK(0));
+    EXPECT_EQ(0u, msgSelf_->nTimer());
+
+    EXPECT_TRUE(msgSelf_->newMsgAfterOK(0ms, d1MsgHdlr_)) << "REQ: 0 = next tick";
+    this_thread::sleep_for(2ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({1}), hdlrIDs_);
+}
+TEST_F(MsgSelfTest, timedMsg_afterIdle_stillFromNow)
+{
+    EXPECT_TRUE(msgSelf_->newMsgAfterOK(0ms, d1MsgHdlr_));
+    this_thread::sleep_for(2ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(0u, msgSelf_->nTimer());
+
+    this_thread::sleep_for(300ms);  // idle: no timer so handleAllMsg() never advances wheel
+    EXPECT_TRUE(msgSelf_->newMsgAfterOK(200ms, d2MsgHdlr_));
+    EXPECT_GT(msgSelf_->waitNs(1'000'000'000), 150'000'000u) << "REQ: due from now, not from stale wheel tick";
+    this_thread::sleep_for(20ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({1}), hdlrIDs_) << "REQ: not fire early";
+}
+TEST_F(MsgSelfTest, armTimer_sameWheel_cbInHandle_exactDisarm)
+{
+    EXPECT_EQ(0u, msgSelf_->armTimer(1ms, nullptr)) << "REQ: NOK null";
+    EXPECT_EQ(0u, msgSelf_->armTimer(-1ms, MsgCB(d1MsgHdlr_))) << "REQ: NOK negative";
+    EXPECT_FALSE(msgSelf_->disarmTimerOK(0));
+
+    const auto timer = msgSelf_->armTimer(10ms, MsgCB(d1MsgHdlr_));
+    EXPECT_NE(0u, timer);
+    EXPECT_EQ(0u, msgSelf_->nTimer()) << "REQ: not a timed msg";
+    EXPECT_LE(msgSelf_->waitNs(1'000'000'000), 11'000'000u) << "REQ: main loop wakes up by raw timer too";
+    EXPECT_TRUE(msgSelf_->disarmTimerOK(timer));
+    EXPECT_FALSE(msgSelf_->disarmTimerOK(timer)) << "REQ: disarmed already";
+    EXPECT_EQ(1'000'000'000u, msgSelf_->waitNs(1'000'000'000));
+
+    EXPECT_NE(0u, msgSelf_->armTimer(1ms, MsgCB(d1MsgHdlr_)));
+    this_thread::sleep_for(3ms);
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({1}), hdlrIDs_) << "REQ: driven by handleAllMsg()";
+    EXPECT_EQ(0u, msgSelf_->nMsg()) << "REQ: cb in wheel advance, not queued";
+}
+TEST_F(MsgSelfTest, GOLD_perf_100K_timedMsg)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N = 100'000;
+    size_t nCalled = 0;
+    const MsgCB msg = [&nCalled]{ ++nCalled; };
+    auto t0 = steady_clock::now();
+    for (size_t i = 0; i < N; ++i)
+        EXPECT_TRUE(msgSelf_->newMsgAfterOK(milliseconds(i % 10), msg));
+    auto t1 = steady_clock::now();
+    this_thread::sleep_for(20ms);
+    auto t2 = steady_clock::now();
+    msgSelf_->handleAllMsg();
+    auto t3 = steady_clock::now();
+    EXPECT_EQ(N, nCalled);
+
+    const auto nsArm  = duration_cast<nanoseconds>(t1 - t0).count() / N;
+    const auto nsFire = duration_cast<nanoseconds>(t3 - t2).count() / N;
+    EXPECT_LT(nsArm + nsFire, 5'000) << "REQ: cheap, arm=" << nsArm << "ns, fire=" << nsFire << "ns";
+    // measured (-O1, as ut) per timed msg: arm ~550ns (clock + map node + wheel node), fire+run ~130ns
+    //   . vs a thread per timer: 8MB stack reserved + spawn/join in 10us class
+}
+
+#define INLINE_MSG
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_inlineMsg_moveOnly_bigOnHeap_ringWrap)
+{
+    struct Cap48 { char c_[48]; };
+    auto small = [cap = Cap48(), this]{ hdlrIDs_.push(cap.c_[0]); };
+    static_assert(InlineMsg::isInline<decltype(small)>(), "REQ: common msg (<= MSG_INLINE_SZ) no heap");
+    static_assert(sizeof(InlineMsg) == 64, "REQ: 1 cache line per queued msg");
+
+    auto res = make_unique<int>(7);
+    EXPECT_TRUE(msgSelf_->newMsgOK([res = std::move(res), this]{ hdlrIDs_.push(*res); })) << "REQ: move-only msg";
+    struct Cap100 { char c_[100]; };
+    auto big = [cap = Cap100(), this]{ hdlrIDs_.push(100); };
+    static_assert(! InlineMsg::isInline<decltype(big)>());
+    EXPECT_TRUE(msgSelf_->newMsgOK(big)) << "REQ: big msg still ok (heap)";
+    EXPECT_TRUE(msgSelf_->newMsgOK(+[]{})) << "REQ: fn ptr";
+    EXPECT_FALSE(msgSelf_->newMsgOK(static_cast<void(*)()>(nullptr))) << "REQ: null fn ptr NOK";
+    msgSelf_->handleAllMsg();
+    EXPECT_EQ(queue<int>({7, 100}), hdlrIDs_);
+
+    // ring: grow while wrapped, front & back
+    hdlrIDs_ = queue<int>();
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_TRUE(msgSelf_->newMsgOK([this]{ hdlrIDs_.push(0); }));
+        EXPECT_TRUE(msgSelf_->newMsgOK([this]{ hdlrIDs_.push(0); }));
+        EXPECT_TRUE(msgSelf_->resumeMsgOK([this, i]{ hdlrIDs_.push(-i); }, EMsgPri_NORM));
+    }
+    EXPECT_EQ(30u, msgSelf_->nMsg(EMsgPri_NORM));
+    msgSelf_->handleAllMsg();
+    for (int i = 9; i >= 0; --i, hdlrIDs_.pop())
+        EXPECT_EQ(-i, hdlrIDs_.front()) << "REQ: front msgs in LIFO, before back ones";
+    EXPECT_EQ(20u, hdlrIDs_.size());
+}
+
+// ***********************************************************************************************
+TEST_F(MsgSelfTest, GOLD_perf_throughput_vsDequeFunction)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N_ROUND = 1'000;
+    constexpr size_t N_BURST = 1'000;  // msgs queued before handleAllMsg(), eg 1 wave of hdlrs
+    size_t nCalled = 0;
+    struct Cap { void* p_[4]; };  // 40B capture (eg dom* + handle + ...): > std::function's 16B
+    auto msg = [&nCalled, cap = Cap()]() noexcept { nCalled += (cap.p_[0] == nullptr); };
+
+    // old: deque<std::function> (same loop as MsgSelf before RingQ<InlineMsg>)
+    deque<function<void()>> oldQ;
+    auto t0 = steady_clock::now();
+    for (size_t r = 0; r < N_ROUND; ++r)
+    {
+        for (size_t i = 0; i < N_BURST; ++i)
+            oldQ.emplace_back(msg);
+        while (! oldQ.empty())
+        {
+            auto cb = std::move(oldQ.front());
+            oldQ.pop_front();
+            cb();
+        }
+    }
+    auto t1 = steady_clock::now();
+    RingQ<InlineMsg> newQ;  // msgQueues_[pri].fifo_ now
+    for (size_t r = 0; r < N_ROUND; ++r)
+    {
+        for (size_t i = 0; i < N_BURST; ++i)
+            newQ.push_back(InlineMsg(msg));
+        while (! newQ.empty())
+            newQ.pop_front()();
+    }
+    auto t2 = steady_clock::now();
+    for (size_t r = 0; r < N_ROUND; ++r)
+    {
+        for (size_t i = 0; i < N_BURST; ++i)
+            (void)msgSelf_->newMsgOK(msg);
+        msgSelf_->handleAllMsg();
+    }
+    auto t3 = steady_clock::now();
+    EXPECT_EQ(3 * N_ROUND * N_BURST, nCalled);
+
+    const auto nsOld  = duration_cast<nanoseconds>(t1 - t0).count() / (N_ROUND * N_BURST);
+    const auto nsNew  = duration_cast<nanoseconds>(t2 - t1).count() / (N_ROUND * N_BURST);
+    const auto nsSelf = duration_cast<nanoseconds>(t3 - t2).count() / (N_ROUND * N_BURST);
+    // - measured (-O1) per msg: deque<function> ~23ns (heap per msg) vs RingQ<InlineMsg> ~8ns
+    //   . MsgSelf ~21ns: + validate, nMsg_, mt_pingMainTH() per msg
+    //   . MsgSelf ~90ns w/ MSG_SELF_STATS=1 (as ut; every msg sampled), ~30ns w/ =16
+    EXPECT_LT(nsNew, nsOld) << "new=" << nsNew << "ns, old=" << nsOld << "ns, MsgSelf=" << nsSelf << "ns";
+}
+
 #define SAFE
 // ***********************************************************************************************
 TEST_F(MsgSelfTest, invalidMsg_noCrash)
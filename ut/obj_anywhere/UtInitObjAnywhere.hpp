@@ -23,6 +23,7 @@
 #include "PriDomino.hpp"
 #include "FreeHdlrDomino.hpp"
 #include "RmEvDom.hpp"
+#include "StaticDom.hpp"
 
 // ***********************************************************************************************
 // UT req: combined domino shall pass all UT
@@ -46,6 +47,13 @@ using MaxNofreeDom = RmEvDom<PriDomino<MultiHdlrDomino<HdlrDomino<MinWbasicDatDo
 using MinRmEvDom =                                                                         RmEvDom<Domino>;
 using MaxDom = WbasicDatDom<MultiHdlrDomino<DataDomino<FreeHdlrDomino<PriDomino<HdlrDomino<MinRmEvDom>>>>>>;
 
+// same layers as MaxDom but static composition
+struct StaticMaxDom final : public StaticDom<WbasicDatDom<MultiHdlrDomino<DataDomino<FreeHdlrDomino<PriDomino<
+    HdlrDomino<RmEvDom<StaticCore<StaticMaxDom>>>>>>>>>
+{
+    explicit StaticMaxDom(const LogName& aUniLogName = ULN_DEFAULT) : StaticDom(aUniLogName) {}
+};
+
 // ***********************************************************************************************
 struct UtInitObjAnywhere : public UniLog, public Test
 {
@@ -77,6 +85,8 @@ struct UtInitObjAnywhere : public UniLog, public Test
             << "REQ: init MaxDom";
         EXPECT_TRUE(ObjAnywhere::emplaceObjOK(MAKE_PTR<MaxNofreeDom>   (uniLogName()), *this))
             << "REQ: init MaxNofreeDom";
+        EXPECT_TRUE(ObjAnywhere::emplaceObjOK(MAKE_PTR<StaticMaxDom>   (uniLogName()), *this))
+            << "REQ: init StaticMaxDom";
 
         // - example how main() callback MsgSelf to handle all msgs
         // - this lambda hides all impl details but a common interface = function<void()>
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <chrono>
+#include <gtest/gtest.h>
+#include <sys/epoll.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "EpollLoop.hpp"
+#include "MsgSelf.hpp"
+
+using namespace std;
+using namespace std::chrono;
+using namespace testing;
+
+namespace rlib
+{
+// ***********************************************************************************************
+struct EpollLoopTest : public Test, public UniLog
+{
+    EpollLoopTest() : UniLog(UnitTest::GetInstance()->current_test_info()->name())
+    {
+        mt_getMainTH();
+        EXPECT_EQ(0, pipe(pipe_));
+    }
+    ~EpollLoopTest()
+    {
+        close(pipe_[0]);
+        close(pipe_[1]);
+        GTEST_LOG_FAIL
+    }
+    void writePipe() { EXPECT_EQ(1, write(pipe_[1], "x", 1)); }
+
+    int pipe_[2] = {-1, -1};  // [0] read, [1] write
+    MT_EvFdNotifier ping_;
+    EpollLoop loop_{ping_, uniLogName()};
+    vector<uint32_t> events_;
+};
+
+// ***********************************************************************************************
+TEST_F(EpollLoopTest, GOLD_fdAndPing_in1wait)
+{
+    EXPECT_TRUE(loop_.addFdOK(pipe_[0], EPOLLIN, [this](uint32_t aEvents)
+    {
+        char buf;
+        EXPECT_EQ(1, read(pipe_[0], &buf, 1));
+        events_.push_back(aEvents);
+    }));
+    EXPECT_EQ(1u, loop_.nFd());
+
+    auto t0 = steady_clock::now();
+    thread writer([this]{ this_thread::sleep_for(20ms); writePipe(); });
+    EXPECT_EQ(1u, loop_.timedwait(1, 0)) << "REQ: wake by usr fd";
+    writer.join();
+    EXPECT_EQ(vector<uint32_t>{EPOLLIN}, events_);
+    EXPECT_LT(steady_clock::now() - t0, 500ms) << "REQ: not till timeout";
+
+    t0 = steady_clock::now();
+    thread pinger([this]{ this_thread::sleep_for(20ms); ping_.mt_notify(); });
+    EXPECT_EQ(0u, loop_.timedwait(1, 0)) << "REQ: wake by ping, no usr cb";
+    pinger.join();
+    EXPECT_LT(steady_clock::now() - t0, 500ms);
+
+    t0 = steady_clock::now();
+    EXPECT_EQ(0u, loop_.timedwait(0, 30'000'000)) << "REQ: ping consumed; timeout";
+    EXPECT_GE(steady_clock::now() - t0, 29ms);
+}
+TEST_F(EpollLoopTest, cbRmItself_nokInvalid)
+{
+    EXPECT_FALSE(loop_.addFdOK(pipe_[0], EPOLLIN, nullptr)) << "REQ: NOK null cb";
+    EXPECT_FALSE(loop_.addFdOK(-1, EPOLLIN, [](uint32_t){})) << "REQ: NOK invalid fd";
+    EXPECT_FALSE(loop_.addFdOK(ping_.fd(), EPOLLIN, [](uint32_t){})) << "REQ: NOK ping fd";
+    EXPECT_FALSE(loop_.rmFdOK(pipe_[0])) << "REQ: NOK not added";
+
+    EXPECT_TRUE(loop_.addFdOK(pipe_[0], EPOLLIN, [this](uint32_t aEvents)
+    {
+        events_.push_back(aEvents);
+        EXPECT_TRUE(loop_.rmFdOK(pipe_[0])) << "REQ: safe to rm itself";
+    }));
+    EXPECT_FALSE(loop_.addFdOK(pipe_[0], EPOLLIN, [](uint32_t){})) << "REQ: NOK dup";
+
+    writePipe();
+    EXPECT_EQ(1u, loop_.timedwait(0, 0));
+    EXPECT_EQ(0u, loop_.nFd());
+    EXPECT_EQ(0u, loop_.timedwait(0, 0)) << "REQ: no cb after rm (though still readable)";
+    EXPECT_EQ(1u, events_.size());
+}
+#if MT_PING_EVENTFD
+TEST_F(EpollLoopTest, GOLD_mainLoop_msgSelf_fromWorker_andTimedMsg)
+{
+    EpollLoop mainLoop(uniLogName());  // on mt_pingMainTH()
+    MsgSelf msgSelf(uniLogName());
+    vector<int> got;
+    EXPECT_TRUE(msgSelf.newMsgAfterOK(30ms, [&got]{ got.push_back(2); }));
+    thread worker([&]{ this_thread::sleep_for(10ms); EXPECT_TRUE(msgSelf.mt_newMsgOK([&got]{ got.push_back(1); })); });
+
+    const auto t0 = steady_clock::now();
+    while (got.size() < 2 && steady_clock::now() - t0 < 3s)
+    {
+        (void)mainLoop.timedwait(0, msgSelf.waitNs(999'999'999));
+        msgSelf.handleAllMsg();
+    }
+    worker.join();
+    EXPECT_EQ((vector<int>{1, 2}), got) << "REQ: cross-thread msg & timed msg via 1 blocking call";
+    EXPECT_LT(steady_clock::now() - t0, 500ms) << "REQ: not by 1s timeout";
+}
+#endif
+
+}  // namespace
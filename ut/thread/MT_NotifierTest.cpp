@@ -6,15 +6,19 @@
 // ***********************************************************************************************
 // - basic notify/wait/timeout/dedup already covered via ThreadBackTest, MtInQueueTest, MsgSelfTest
 // ***********************************************************************************************
+#include <atomic>
 #include <chrono>
 #include <future>
 #include <gtest/gtest.h>
+#include <poll.h>
 #include <thread>
 #include <time.h>
+#include <vector>
 
 #include "UniLog.hpp"
 
 #define IN_GTEST
+#include "MT_EvFdNotifier.hpp"
 #include "MT_Notifier.hpp"
 #include "MT_PingMainTH.hpp"
 #undef IN_GTEST
@@ -182,4 +186,89 @@ TEST_F(MT_NotifierTest, GOLD_noImmediateNextWakeup)
     EXPECT_GE(ms, 45) << "REQ: immediate 2nd wakeup doesn't make sense";
 }
 
+// ***********************************************************************************************
+TEST_F(MT_NotifierTest, GOLD_coalesce_1postTillNextTimedwait)
+{
+    notif_.reset();
+    notif_.mt_notify();
+    notif_.timedwait(0, 0);  // re-arm
+
+    notif_.mt_notify();  // posted
+    notif_.mt_notify();  // coalesced
+    notif_.timedwait(0, 50'000'000);  // wake at once, re-arm
+    notif_.mt_notify();  // REQ: posted again after re-arm (main may sleep soon)
+
+    auto t0 = chrono::steady_clock::now();
+    notif_.timedwait(0, 50'000'000);
+    auto ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+    EXPECT_LT(ms, 10) << "REQ: notify after re-arm never lost";
+}
+
+TEST_F(MT_NotifierTest, GOLD_perf_8producers_vsPostEach)
+{
+#ifndef DOMLIB_UT
+    GTEST_SKIP() << "env-sensitive benchmark, run only without -Dci";
+#endif
+    constexpr size_t N_TH = 8;
+    constexpr size_t N    = 100'000;  // per producer
+    auto run = [](auto&& aNotify, auto&& aWait)  // ret ns per notify
+    {
+        atomic<size_t> nDone{0};
+        vector<thread> producers;
+        const auto t0 = chrono::steady_clock::now();
+        for (size_t th = 0; th < N_TH; ++th)
+            producers.emplace_back([&]{ for (size_t i = 0; i < N; ++i) aNotify(); ++nDone; });
+        while (nDone < N_TH)  // main as a busy main loop: wake, drain, wait again
+            aWait();
+        for (auto&& producer : producers)
+            producer.join();
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count() / (N_TH * N);
+    };
+
+    sem_t sem;  // as before coalescing: post per notify
+    sem_init(&sem, 0, 0);
+    const auto nsPostEach = run([&sem]{ sem_post(&sem); }, [&sem]
+    {
+        timespec ts{0, 0};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        ts.tv_nsec += 1'000'000;
+        if (ts.tv_nsec >= 1'000'000'000) { ++ts.tv_sec; ts.tv_nsec -= 1'000'000'000; }
+        sem_clockwait(&sem, CLOCK_MONOTONIC, &ts);
+        for (int i = 0; i < 100 && sem_trywait(&sem) == 0; ++i);
+    });
+    sem_destroy(&sem);
+    notif_.reset();
+    const auto nsCoalesce = run([this]{ notif_.mt_notify(); }, [this]{ notif_.timedwait(0, 1'000'000); });
+
+    EXPECT_LT(nsCoalesce, nsPostEach) << "REQ: faster, coalesce=" << nsCoalesce << "ns, postEach=" << nsPostEach << "ns";
+    // measured (-O1, 1 cpu VM) per notify: post each ~260ns (futex wake while main sleeps), coalesce ~20ns
+}
+
+// ***********************************************************************************************
+TEST(MT_EvFdNotifierTest, GOLD_notify_coalesce_timeout_fdReadable)
+{
+    mt_getMainTH();
+    MT_EvFdNotifier notif;
+    ASSERT_GE(notif.fd(), 0);
+    notif.reset();
+
+    thread([&notif]{ notif.mt_notify(); notif.mt_notify(); }).join();  // 2nd coalesced
+    pollfd pfd{notif.fd(), POLLIN, 0};
+    EXPECT_EQ(1, poll(&pfd, 1, 0)) << "REQ: fd readable = notified (for epoll)";
+
+    auto t0 = chrono::steady_clock::now();
+    notif.timedwait(0, 50'000'000);
+    auto ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+    EXPECT_LT(ms, 10) << "REQ: wake at once";
+    EXPECT_EQ(0, poll(&pfd, 1, 0)) << "REQ: consumed all";
+
+    t0 = chrono::steady_clock::now();
+    notif.timedwait(0, 50'000'000);
+    ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+    EXPECT_GE(ms, 45) << "REQ: timeout; no immediate 2nd wakeup";
+
+    notif.mt_notify();
+    EXPECT_EQ(1, poll(&pfd, 1, 0)) << "REQ: re-armed after timedwait()";
+}
+
 }  // namespace